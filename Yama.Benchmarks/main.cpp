@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+#include <yama/yama.h>
+#include <yama++/print.h>
+
+
+namespace {
+    // Runs f iterations times (after warming up), printing the mean time per iteration.
+    template<typename F>
+    void bench(std::string_view name, size_t iterations, F&& f) {
+        for (size_t i = 0; i < iterations / 10; i++) {
+            f();
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            f();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        ym::println("{:<32} {:>12.1f} ns/iter ({} iters)", name, double(ns) / double(iterations), iterations);
+    }
+
+    // Stands in for the work a request handler does w/ its context.
+    void handleRequest(YmCtx* ctx) {
+        (void)ymCtx_Load(ctx, "p:A");
+        for (YmInt i = 0; i < 8; i++) {
+            (void)ymCtx_PutInt(ctx, YM_PUSH, i);
+        }
+    }
+
+    void benchCtxCreation(YmDm* dm) {
+        constexpr size_t iterations = 100'000;
+        bench("ctx create/release", iterations, [dm] {
+            auto ctx = ymCtx_Create(dm);
+            handleRequest(ctx);
+            ymCtx_Release(ctx);
+            });
+        bench("ctx acquire/return", iterations, [dm] {
+            auto ctx = ymDm_AcquireCtx(dm);
+            handleRequest(ctx);
+            ymCtx_ReturnToPool(ctx);
+            });
+    }
+
+    // Submits jobs calls of fn w/ arg n to executors w/ 1 to N workers (doubling each time),
+    // printing throughput, and speedup relative to 1 worker.
+    void benchExecutorScaling(YmDm* dm, std::string_view name, YmFullname fn, YmUInt n, size_t jobs) {
+        const size_t maxWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+        double baseline = 0.0;
+        for (size_t workers = 1; ; workers = std::min(workers * 2, maxWorkers)) {
+            auto executor = ymExecutor_Create(dm, workers);
+            const YmPrimitive args[] = { { .kind = YmPrimitiveKind_UInt, .ui = n } };
+            // Warm up worker contexts, so first loads aren't measured.
+            for (size_t i = 0; i < workers; i++) {
+                ymExecutor_Submit(executor, fn, args, 1, "", nullptr, nullptr);
+            }
+            ymExecutor_Wait(executor);
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < jobs; i++) {
+                ymExecutor_Submit(executor, fn, args, 1, "", nullptr, nullptr);
+            }
+            ymExecutor_Wait(executor);
+            const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            ymExecutor_Release(executor);
+            const double throughput = double(jobs) / elapsed;
+            if (workers == 1) {
+                baseline = throughput;
+            }
+            ym::println("{:<20} {:>3} workers {:>12.0f} jobs/s ({:.2f}x)", name, workers, throughput, throughput / baseline);
+            if (workers == maxWorkers) {
+                break;
+            }
+        }
+    }
+
+    // fib(n: UInt) -> UInt, recursing via Yama calls, so it exercises the call machinery.
+    void fib(YmCtx* ctx, YmType*, void*) {
+        const YmUInt n = ymObj_ToUInt(ymCtx_Arg(ctx, 0, YM_BORROW), nullptr);
+        if (n < 2) {
+            ymCtx_Ret(ctx, ymCtx_NewUInt(ctx, n), YM_TAKE);
+            return;
+        }
+        ymCtx_PutUInt(ctx, YM_PUSH, n - 1);
+        ymCtx_Call(ctx, ymCtx_Ref(ctx, 0), 1, "", YM_PUSH);
+        ymCtx_PutUInt(ctx, YM_PUSH, n - 2);
+        ymCtx_Call(ctx, ymCtx_Ref(ctx, 0), 1, "", YM_PUSH);
+        const YmUInt a = ymObj_ToUInt(ymCtx_Local(ctx, 0, YM_BORROW), nullptr);
+        const YmUInt b = ymObj_ToUInt(ymCtx_Local(ctx, 1, YM_BORROW), nullptr);
+        ymCtx_Ret(ctx, ymCtx_NewUInt(ctx, a + b), YM_TAKE);
+    }
+
+    // nop(n: UInt) -> None, so per-job scheduling overhead (ie. queue locking, and waking
+    // workers) dominates.
+    void nop(YmCtx* ctx, YmType*, void*) {
+        ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+    }
+}
+
+
+int32_t main(int32_t argc, char** argv) {
+    auto dm = ymDm_Create();
+    auto p_def = ymParcelDef_Create();
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddFn(p_def, "fib", "yama:UInt", fib, nullptr);
+    ymParcelDef_AddParam(p_def, "fib", "n", "yama:UInt");
+    ymParcelDef_AddRef(p_def, "fib", "%here:fib");
+    ymParcelDef_AddFn(p_def, "nop", "yama:None", nop, nullptr);
+    ymParcelDef_AddParam(p_def, "nop", "n", "yama:UInt");
+    ymDm_BindParcelDef(dm, "p", p_def);
+    ymParcelDef_Release(p_def);
+
+    benchCtxCreation(dm);
+    benchExecutorScaling(dm, "executor fib(16)", "p:fib", 16, 2'000);
+    benchExecutorScaling(dm, "executor nop", "p:nop", 0, 200'000);
+
+    ymDm_Release(dm);
+    return 0;
+}
+
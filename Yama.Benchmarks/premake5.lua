@@ -0,0 +1,29 @@
+
+
+project "Yama.Benchmarks"
+	
+	kind "ConsoleApp"
+	targetname "Benchmarks"
+	
+	files
+	{
+		"**.h",
+		"**.cpp",
+		"**.c",
+		"**.txt",
+		"**.taul",
+		"**.yama"
+	}
+	
+	includedirs
+	{
+		"../Yama",
+        "../vendor/TAUL/taul"
+	}
+	
+	links
+	{
+		"Yama",
+		"TAUL"
+	}
+
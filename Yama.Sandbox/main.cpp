@@ -79,7 +79,7 @@ int32_t main(int32_t argc, char** argv) {
     ym::println("{}", ym::converts(B, Hash));
     ym::println("{}", ym::converts(B, Hash, true));
 
-    ym::println("{}", ctx.newFloat(3.14159));
+    ym::println("{}", ctx.newFloat(3.14159).value());
     ym::println("{}", ctx.ldBool());
     ym::println("{}", Hash);
     ym::println("{}", ctx.import("p").value());
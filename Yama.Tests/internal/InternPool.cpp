@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <internal/InternPool.h>
+
+
+TEST(InternPool, EqualStringsShareEntry) {
+	_ym::IStr a = "abc";
+	_ym::IStr b = std::string("abc");
+	_ym::IStr c = "def";
+	EXPECT_EQ(a, b);
+	EXPECT_NE(a, c);
+	EXPECT_EQ(&a.string(), &b.string()); // Same entry.
+	EXPECT_EQ(a.hash(), b.hash());
+	EXPECT_EQ(a, "abc");
+	EXPECT_EQ(a, std::string("abc"));
+	EXPECT_EQ(c.string(), "def");
+}
+
+TEST(InternPool, DefaultIsEmptyString) {
+	_ym::IStr a{};
+	EXPECT_TRUE(a.empty());
+	EXPECT_EQ(a, _ym::IStr(""));
+}
+
+TEST(InternPool, HashAgreesWithStringLookup) {
+	std::unordered_map<_ym::IStr, int> m{};
+	m.try_emplace("abc", 1);
+	m.try_emplace("def", 2);
+	ASSERT_TRUE(m.contains(std::string("abc")));
+	ASSERT_TRUE(m.contains(std::string_view("def")));
+	EXPECT_FALSE(m.contains(std::string("ghi")));
+	EXPECT_EQ(m.find(std::string("abc"))->second, 1);
+	EXPECT_EQ(m.find(_ym::IStr("def"))->second, 2);
+}
+
+TEST(InternPool, EntriesAreReleased) {
+	auto& pool = _ym::InternPool::global();
+	const size_t before = pool.count();
+	{
+		_ym::IStr a = "InternPool.EntriesAreReleased";
+		_ym::IStr b = a;
+		EXPECT_EQ(pool.count(), before + 1);
+	}
+	EXPECT_EQ(pool.count(), before); // Removed w/ last handle.
+}
+
+TEST(InternPool, Ordering) {
+	_ym::IStr a = "abc";
+	_ym::IStr b = "abd";
+	EXPECT_LT(a, b);
+	EXPECT_GT(b, a);
+	EXPECT_EQ(a <=> _ym::IStr("abc"), std::strong_ordering::equal);
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <internal/Section.h>
+
+
+namespace {
+	struct Node final {
+		using Name = std::string;
+		using Id = size_t;
+
+
+		std::string name;
+		size_t id;
+		std::vector<const Node*> deps;
+
+
+		inline const Name& getName() const noexcept { return name; }
+		inline const Id& getId() const noexcept { return id; }
+
+		template<typename Visitor>
+		inline void visitDeps(Visitor&& visitor) const {
+			for (const Node* dep : deps) visitor(*dep);
+		}
+	};
+
+	std::shared_ptr<Node> node(std::string name, size_t id) {
+		return std::make_shared<Node>(Node{ .name = std::move(name), .id = id, .deps = {} });
+	}
+}
+
+
+TEST(Section, Prune_KeepsOnlyReachableResources) {
+	_ym::Section<Node> s{};
+	auto a = node("a", 0), b = node("b", 1), c = node("c", 2), d = node("d", 3);
+	a->deps = { b.get() };
+	b->deps = { c.get() };
+	ASSERT_TRUE(s.push(a));
+	ASSERT_TRUE(s.push(b));
+	ASSERT_TRUE(s.push(c));
+	ASSERT_TRUE(s.push(d));
+	s.prune(*a);
+	EXPECT_EQ(s.count(), 3);
+	EXPECT_TRUE(s.exists("a"));
+	EXPECT_TRUE(s.exists("b"));
+	EXPECT_TRUE(s.exists("c"));
+	EXPECT_FALSE(s.exists("d"));
+	EXPECT_FALSE(s.existsById(3));
+}
+
+TEST(Section, Prune_HandlesCyclesAndNamelessResources) {
+	_ym::Section<Node> s{};
+	auto a = node("a", 0), b = node("b", 1), c = node("c", 2);
+	a->deps = { b.get() };
+	b->deps = { a.get() };
+	c->deps = { a.get() };
+	ASSERT_TRUE(s.push(a));
+	ASSERT_TRUE(s.push(b, true));
+	ASSERT_TRUE(s.push(c, true));
+	s.prune(*a);
+	EXPECT_EQ(s.count(), 2);
+	EXPECT_TRUE(s.existsById(0));
+	EXPECT_TRUE(s.existsById(1));
+	EXPECT_FALSE(s.existsById(2));
+}
+
+TEST(Section, Prune_DoesNotTraverseUpstream) {
+	_ym::Section<Node> upstream{}, s{};
+	s.setUpstream(&upstream);
+	auto u = node("u", 0), a = node("a", 1), b = node("b", 2);
+	a->deps = { u.get() };
+	u->deps = { b.get() }; // Not actually possible, but tests that upstream isn't traversed.
+	ASSERT_TRUE(upstream.push(u));
+	ASSERT_TRUE(s.push(a));
+	ASSERT_TRUE(s.push(b));
+	s.prune(*a);
+	EXPECT_EQ(s.count(true), 1);
+	EXPECT_TRUE(s.exists("a", true));
+	EXPECT_FALSE(s.exists("b", true));
+	EXPECT_EQ(upstream.count(), 1);
+}
+
+TEST(Section, Prune_DiscardsAllIfRootIsUpstream) {
+	_ym::Section<Node> upstream{}, s{};
+	s.setUpstream(&upstream);
+	auto u = node("u", 0), a = node("a", 1);
+	u->deps = { a.get() };
+	ASSERT_TRUE(upstream.push(u));
+	ASSERT_TRUE(s.push(a));
+	s.prune(*u);
+	EXPECT_EQ(s.count(true), 0);
+	EXPECT_EQ(upstream.count(), 1);
+}
+
+TEST(Section, CommitReachableOrDiscard) {
+	_ym::Section<Node> upstream{}, s{};
+	s.setUpstream(&upstream);
+	auto a = node("a", 0), b = node("b", 1), c = node("c", 2);
+	a->deps = { b.get() };
+	ASSERT_TRUE(s.push(a));
+	ASSERT_TRUE(s.push(b));
+	ASSERT_TRUE(s.push(c));
+	s.commitReachableOrDiscard(a.get());
+	EXPECT_EQ(s.count(true), 0);
+	EXPECT_EQ(upstream.count(), 2);
+	EXPECT_TRUE(upstream.exists("a"));
+	EXPECT_TRUE(upstream.exists("b"));
+	EXPECT_FALSE(upstream.exists("c"));
+}
+
+TEST(Section, CommitReachableOrDiscard_NoRoot) {
+	_ym::Section<Node> upstream{}, s{};
+	s.setUpstream(&upstream);
+	ASSERT_TRUE(s.push(node("a", 0)));
+	s.commitReachableOrDiscard(nullptr);
+	EXPECT_EQ(s.count(true), 0);
+	EXPECT_EQ(upstream.count(), 0);
+}
+
+TEST(Section, MarkAndSweep) {
+	_ym::Section<Node> s{};
+	auto a = node("a", 0), b = node("b", 1), c = node("c", 2), d = node("d", 3), e = node("e", 4);
+	a->deps = { b.get() };
+	c->deps = { d.get() };
+	d->deps = { c.get() };
+	ASSERT_TRUE(s.push(std::move(a)));
+	ASSERT_TRUE(s.push(std::move(b)));
+	ASSERT_TRUE(s.push(std::move(c)));
+	ASSERT_TRUE(s.push(std::move(d), true));
+	ASSERT_TRUE(s.push(e, true)); // We keep sharing e.
+	auto isRoot = [](const Node& x, bool shared) { return shared || x.name == "a"; };
+	auto candidates = s.mark(s.snapshot(isRoot));
+	EXPECT_EQ(candidates.size(), 2);
+	const auto swept = s.sweep(std::move(candidates), isRoot);
+	EXPECT_EQ(swept.size(), 2);
+	EXPECT_EQ(s.count(), 3);
+	EXPECT_TRUE(s.exists("a"));
+	EXPECT_TRUE(s.exists("b"));
+	EXPECT_FALSE(s.exists("c"));
+	EXPECT_FALSE(s.existsById(3));
+	EXPECT_TRUE(s.existsById(4));
+}
+
+TEST(Section, MarkAndSweep_CandidatesRevivedBeforeSweepAreKept) {
+	_ym::Section<Node> s{};
+	auto a = node("a", 0), b = node("b", 1);
+	a->deps = { b.get() };
+	b->deps = { a.get() };
+	ASSERT_TRUE(s.push(std::move(a)));
+	ASSERT_TRUE(s.push(std::move(b), true));
+	auto isRoot = [](const Node&, bool shared) { return shared; };
+	auto candidates = s.mark(s.snapshot(isRoot));
+	EXPECT_EQ(candidates.size(), 2);
+	const auto revived = s.fetch("a"); // Acquired between mark and sweep.
+	const auto swept = s.sweep(std::move(candidates), isRoot);
+	EXPECT_EQ(swept.size(), 0);
+	EXPECT_EQ(s.count(), 2); // b is kept as it's reachable from a.
+}
+
+TEST(Section, MarkAndSweep_CandidatesDependedUponByResourcesAddedSinceSnapshotAreKept) {
+	_ym::Section<Node> s{}, staging{};
+	staging.setUpstream(&s);
+	auto a = node("a", 0), b = node("b", 1), c = node("c", 2), d = node("d", 3);
+	a->deps = { b.get() };
+	ASSERT_TRUE(s.push(std::move(a), true));
+	ASSERT_TRUE(s.push(std::move(b), true));
+	ASSERT_TRUE(s.push(std::move(c), true));
+	auto isRoot = [](const Node& x, bool shared) { return shared || x.name == "c" || x.name == "d"; };
+	auto snapshot = s.snapshot(isRoot);
+	// Resources may be added between snapshot and sweep, as marking doesn't block doing so.
+	d->deps = { s.fetchById(0).get() };
+	ASSERT_TRUE(staging.push(std::move(d)));
+	staging.commit();
+	auto candidates = s.mark(std::move(snapshot));
+	EXPECT_EQ(candidates.size(), 2);
+	const auto swept = s.sweep(std::move(candidates), isRoot);
+	EXPECT_EQ(swept.size(), 0);
+	EXPECT_EQ(s.count(), 4); // a is kept as d depends upon it, and b as a does.
+}
+
+TEST(Section, MarkAndSweep_CandidatesDiscardedBeforeSweepAreSkipped) {
+	_ym::Section<Node> s{};
+	ASSERT_TRUE(s.push(node("a", 0)));
+	auto isRoot = [](const Node&, bool shared) { return shared; };
+	auto candidates = s.mark(s.snapshot(isRoot));
+	EXPECT_EQ(candidates.size(), 1);
+	s.discard();
+	ASSERT_TRUE(s.push(node("a", 0)));
+	const auto swept = s.sweep(std::move(candidates), isRoot);
+	EXPECT_EQ(swept.size(), 0);
+	EXPECT_EQ(s.count(), 1);
+}
@@ -0,0 +1,37 @@
+
+
+#include <gtest/gtest.h>
+#include <yama/yama.h>
+#include <yama++/Context.h>
+
+#include "../utils/utils.h"
+
+
+TEST(Context, NewObject_Fail_MemLimitExceeded) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    bool allocated = true;
+    ymParcelDef_AddFn(p_def, "f", "yama:None",
+        [](YmCtx* ctx_, YmType*, void* user) {
+            auto ctx = ym::Context(*ctx_, true);
+            auto result = ctx.newNone();
+            *(bool*)user = result.has_value();
+            ctx.ret(result);
+        },
+        &allocated);
+    ymDm_BindParcelDef(dm, "p", p_def);
+    auto f = load(ctx, "p:f");
+    ymCtx_SetMemLimit(ctx, 64);
+    for (size_t i = 0; i < 100; i++) {
+        ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 0), YM_TRUE);
+    }
+
+    // Fails w/out crashing, as ctx.newNone returns std::nullopt.
+    EXPECT_EQ(ymCtx_Call(ctx, f, 0, "", YM_DISCARD), YM_FALSE);
+    EXPECT_FALSE(allocated);
+    EXPECT_EQ(err[YmErrCode_MemLimitExceeded], 2); // Allocation of return value, and call of f.
+
+    ymCtx_SetMemLimit(ctx, 0);
+    EXPECT_EQ(ymCtx_Call(ctx, f, 0, "", YM_DISCARD), YM_TRUE);
+    EXPECT_TRUE(allocated);
+}
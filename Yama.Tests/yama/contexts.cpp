@@ -1,5 +1,11 @@
 ﻿
 
+#include <array>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <taul/strings.h>
 #include <yama/yama.h>
@@ -39,6 +45,151 @@ TEST(Contexts, RefCounting) {
     EXPECT_EQ(ymCtx_Release(ctx), 1); // Destroys
 }
 
+TEST(Contexts, AcquireCtxAndReturnToPool) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    auto ctx = ymDm_AcquireCtx(dm); // Pool is empty, so creates.
+    ASSERT_TRUE(ctx);
+    EXPECT_EQ(ymCtx_RefCount(ctx), 1);
+    EXPECT_EQ(ymCtx_Dm(ctx, YM_BORROW), dm);
+    YmType* A = load(ctx, "p:A");
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 10), YM_TRUE);
+    EXPECT_EQ(ymCtx_Locals(ctx), 1);
+    EXPECT_EQ(ymCtx_ReturnToPool(ctx), 1); // Resets, and returns to pool.
+
+    auto ctx2 = ymDm_AcquireCtx(dm); // Reused.
+    ASSERT_EQ(ctx2, ctx);
+    EXPECT_EQ(ymCtx_RefCount(ctx2), 1);
+    EXPECT_EQ(ymCtx_CallStackHeight(ctx2), 1); // User Pseudo-Call
+    EXPECT_EQ(ymCtx_Locals(ctx2), 0);
+    EXPECT_EQ(load(ctx2, "p:A"), A); // Reloaded from dm, which still has it.
+    EXPECT_EQ(ymCtx_Release(ctx2), 1); // Destroys.
+}
+
+TEST(Contexts, ReturnToPool_NotLastRef) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    auto ctx = ymDm_AcquireCtx(dm);
+    ASSERT_TRUE(ctx);
+    ymCtx_Secure(ctx);
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 10), YM_TRUE);
+    EXPECT_EQ(ymCtx_ReturnToPool(ctx), 2); // Not returned to pool, as ref remains.
+    EXPECT_EQ(ymCtx_RefCount(ctx), 1);
+    EXPECT_EQ(ymCtx_Locals(ctx), 1); // Not reset.
+    auto ctx2 = ymDm_AcquireCtx(dm);
+    ASSERT_TRUE(ctx2);
+    EXPECT_NE(ctx2, ctx);
+    EXPECT_EQ(ymCtx_ReturnToPool(ctx), 1);
+    EXPECT_EQ(ymCtx_ReturnToPool(ctx2), 1);
+    // Pooled contexts are destroyed along w/ dm.
+}
+
+namespace {
+    // Allocator which counts the blocks it has allocated/deallocated.
+    // Allocations fail (w/out being counted) while fail == true.
+    struct CountingAllocator final {
+        size_t allocated = 0;
+        size_t deallocated = 0;
+        bool fail = false;
+
+
+        YmAllocator allocator() noexcept {
+            return YmAllocator{
+                .user = this,
+                .allocate =
+                    [](void* user, size_t bytes) -> void* {
+                        if (((CountingAllocator*)user)->fail) return nullptr;
+                        ((CountingAllocator*)user)->allocated++;
+                        return std::malloc(bytes);
+                    },
+                .deallocate =
+                    [](void* user, void* block) {
+                        ((CountingAllocator*)user)->deallocated++;
+                        std::free(block);
+                    },
+            };
+        }
+    };
+}
+
+TEST(Contexts, CreateWithAllocator) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    CountingAllocator counter{};
+    const auto allocator = counter.allocator();
+    auto ctx = ymCtx_CreateWithAllocator(dm, &allocator);
+    ASSERT_TRUE(ctx);
+    EXPECT_EQ(ymCtx_RefCount(ctx), 1);
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 10), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 11), YM_TRUE);
+    EXPECT_EQ(counter.allocated, 2);
+    ymCtx_Pop(ctx, 1);
+    EXPECT_EQ(counter.deallocated, 1);
+    EXPECT_EQ(ymCtx_Release(ctx), 1); // Destroys, releasing remaining objects.
+    EXPECT_EQ(counter.deallocated, 2);
+}
+
+TEST(Contexts, CreateWithAllocator_AllocationFailure) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    CountingAllocator counter{};
+    const auto allocator = counter.allocator();
+    auto ctx = ymCtx_CreateWithAllocator(dm, &allocator);
+    ASSERT_TRUE(ctx);
+    auto ctx_ = ym::bindScoped(ym::Safe(ctx));
+    counter.fail = true;
+    EXPECT_FALSE(ymCtx_NewInt(ctx, 10));
+    EXPECT_EQ(err[YmErrCode_MemLimitExceeded], 1);
+    std::array<YmUInt64, YmMemStat_Num> stats{};
+    ymCtx_MemUsage(ctx, nullptr, stats.data());
+    EXPECT_EQ(stats[YmMemStat_Objects], 0);
+    EXPECT_EQ(stats[YmMemStat_Bytes], 0);
+
+    // Recovers once allocator succeeds again.
+    counter.fail = false;
+    YmObj* obj = ymCtx_NewInt(ctx, 10);
+    ASSERT_TRUE(obj);
+    EXPECT_EQ(ymObj_ToInt(obj, nullptr), 10);
+    ymObj_Release(obj);
+    EXPECT_EQ(counter.allocated, 1);
+    EXPECT_EQ(counter.deallocated, 1);
+}
+
+TEST(Contexts, CreateWithAllocator_DefaultOfDm) {
+    SETUP_ERRCOUNTER;
+    CountingAllocator counter{};
+    const auto allocator = counter.allocator();
+    auto dm = ymDm_CreateWithAllocator(&allocator);
+    ASSERT_TRUE(dm);
+    auto dm_ = ym::bindScoped(ym::Safe(dm));
+    for (auto ctx : { ymCtx_Create(dm), ymCtx_CreateWithAllocator(dm, nullptr), ymDm_AcquireCtx(dm) }) {
+        ASSERT_TRUE(ctx);
+        const size_t allocated = counter.allocated;
+        ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 10), YM_TRUE);
+        EXPECT_EQ(counter.allocated, allocated + 1);
+        ymCtx_Release(ctx);
+    }
+    EXPECT_EQ(counter.deallocated, counter.allocated);
+}
+
+TEST(Contexts, CreateWithAllocator_NotPooled) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    CountingAllocator counter{};
+    const auto allocator = counter.allocator();
+    auto ctx = ymCtx_CreateWithAllocator(dm, &allocator);
+    ASSERT_TRUE(ctx);
+    EXPECT_EQ(ymCtx_ReturnToPool(ctx), 1); // Destroys, as ctx doesn't use the allocator of dm.
+    auto ctx2 = ymDm_AcquireCtx(dm);
+    ASSERT_TRUE(ctx2);
+    ASSERT_EQ(ymCtx_PutInt(ctx2, YM_PUSH, 10), YM_TRUE);
+    EXPECT_EQ(counter.allocated, 0); // ctx2 uses the default allocator.
+    EXPECT_EQ(ymCtx_Release(ctx2), 1);
+}
+
 TEST(Contexts, Dm_Borrow) {
     SETUP_ALL(ctx);
     EXPECT_EQ(ymCtx_Dm(ctx, YM_BORROW), dm);
@@ -146,6 +297,198 @@ TEST(Contexts, FastPathLoadFns) {
     EXPECT_EQ(ymCtx_LdType(ctx), ymCtx_Load(ctx, "yama:Type"));
 }
 
+TEST(Contexts, LoadStats) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymDm_BindParcelDef(dm, "p", p_def);
+    SETUP_CTX(other);
+    std::array<YmUInt64, YmLoadStat_Num> stats{};
+    ymCtx_ResetLoadStats(ctx);
+    ymCtx_ResetLoadStats(other);
+    load(ctx, "p:A");
+    ymCtx_GetLoadStats(ctx, stats.data());
+#if defined(YM_LOAD_STATS)
+    EXPECT_GE(stats[YmLoadStat_SpecifiersParsed], 1);
+    EXPECT_EQ(stats[YmLoadStat_TypesGenerated], 1); // Generated by domain on behalf of ctx.
+#else
+    for (const auto& stat : stats) {
+        EXPECT_EQ(stat, 0);
+    }
+#endif
+    // Loads of other contexts aren't recorded to ctx, even if they're serviced by the domain.
+    ymCtx_ResetLoadStats(ctx);
+    load(other, "p:A");
+    ymCtx_GetLoadStats(ctx, stats.data());
+    for (const auto& stat : stats) {
+        EXPECT_EQ(stat, 0);
+    }
+}
+
+TEST(Contexts, Stats) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddFn(p_def, "f", "yama:None",
+        [](YmCtx* ctx, YmType*, void*) {
+            ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+        },
+        nullptr);
+    ymParcelDef_AddFn(p_def, "g", "yama:None", ymInertCallBhvrFn, nullptr); // Fails to return.
+    ymDm_BindParcelDef(dm, "p", p_def);
+    auto f = load(ctx, "p:f");
+    auto g = load(ctx, "p:g");
+    auto Int = load(ctx, "yama:Int");
+    auto Any = load(ctx, "yama:Any");
+    ymCtx_ResetStats(ctx);
+
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 1), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 2), YM_TRUE);
+    ymCtx_Pop(ctx, 1);
+    ASSERT_EQ(ymCtx_Call(ctx, f, 0, "", YM_DISCARD), YM_TRUE);
+    EXPECT_EQ(ymCtx_Call(ctx, g, 0, "", YM_DISCARD), YM_FALSE);
+    ASSERT_EQ(ymCtx_Convert(ctx, Any, YM_PUSH), YM_TRUE); // Boxes.
+    ASSERT_EQ(ymCtx_Convert(ctx, Int, YM_PUSH), YM_TRUE); // Unboxes.
+    std::array<YmUInt64, YmCtxStat_Num> stats{};
+    ymCtx_GetStats(ctx, stats.data());
+#if defined(YM_CTX_STATS)
+    EXPECT_EQ(stats[YmCtxStat_Calls], 2);
+    EXPECT_EQ(stats[YmCtxStat_ProtocolCalls], 0);
+    EXPECT_EQ(stats[YmCtxStat_AccessorCalls], 0);
+    EXPECT_EQ(stats[YmCtxStat_FailedCalls], 1);
+    EXPECT_EQ(stats[YmCtxStat_ObjectsCreated], 4); // Ints, None, and box.
+    EXPECT_EQ(stats[YmCtxStat_ObjectsReleased], 3); // Popped Int, discarded None, and box.
+    EXPECT_EQ(stats[YmCtxStat_Conversions], 2);
+    EXPECT_EQ(stats[YmCtxStat_Boxings], 1);
+    EXPECT_EQ(stats[YmCtxStat_Unboxings], 1);
+    EXPECT_EQ(stats[YmCtxStat_PTablesBuilt], 1);
+    EXPECT_EQ(stats[YmCtxStat_PeakObjectStackHeight], 2);
+    EXPECT_EQ(stats[YmCtxStat_PeakCallStackHeight], 2);
+#else
+    for (const auto& stat : stats) {
+        EXPECT_EQ(stat, 0);
+    }
+#endif
+    ymCtx_ResetStats(ctx);
+    ymCtx_GetStats(ctx, stats.data());
+    for (const auto& stat : stats) {
+        EXPECT_EQ(stat, 0);
+    }
+}
+
+TEST(Contexts, ConversionStats) {
+    SETUP_ALL(ctx);
+    auto Any = load(ctx, "yama:Any");
+    auto conversion = [](YmPrimitiveKind from, YmPrimitiveKind to) -> size_t {
+        return size_t(from) * YmPrimitiveKind_Num + size_t(to);
+        };
+
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 1), YM_TRUE);
+    ASSERT_EQ(ymCtx_Convert(ctx, ymCtx_LdFloat(ctx), YM_PUSH), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 2), YM_TRUE);
+    ASSERT_EQ(ymCtx_Convert(ctx, ymCtx_LdFloat(ctx), YM_PUSH), YM_TRUE);
+    ASSERT_EQ(ymCtx_Convert(ctx, ymCtx_LdUInt(ctx), YM_PUSH), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutBool(ctx, YM_PUSH, YM_TRUE), YM_TRUE);
+    ASSERT_EQ(ymCtx_Convert(ctx, ymCtx_LdInt(ctx), YM_PUSH), YM_TRUE);
+    ASSERT_EQ(ymCtx_Convert(ctx, Any, YM_PUSH), YM_TRUE); // Boxes (ie. primitive -> non-primitive.)
+    std::array<YmUInt64, YmPrimitiveKind_Num * YmPrimitiveKind_Num> stats{};
+    ymCtx_GetConversionStats(ctx, stats.data());
+#if defined(YM_CTX_STATS)
+    EXPECT_EQ(stats[conversion(YmPrimitiveKind_Int, YmPrimitiveKind_Float)], 2);
+    EXPECT_EQ(stats[conversion(YmPrimitiveKind_Float, YmPrimitiveKind_UInt)], 1);
+    EXPECT_EQ(stats[conversion(YmPrimitiveKind_Bool, YmPrimitiveKind_Int)], 1);
+    YmUInt64 total = 0;
+    for (const auto& stat : stats) {
+        total += stat;
+    }
+    EXPECT_EQ(total, 4); // Boxing isn't counted.
+#else
+    for (const auto& stat : stats) {
+        EXPECT_EQ(stat, 0);
+    }
+#endif
+    ymCtx_ResetStats(ctx);
+    ymCtx_GetConversionStats(ctx, stats.data());
+    for (const auto& stat : stats) {
+        EXPECT_EQ(stat, 0);
+    }
+}
+
+TEST(Contexts, MemUsage) {
+    SETUP_ALL(ctx);
+    std::array<YmUInt64, YmMemStat_Num> stats{};
+    ymCtx_MemUsage(ctx, nullptr, stats.data());
+    for (const auto& stat : stats) {
+        EXPECT_EQ(stat, 0);
+    }
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 1), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 2), YM_TRUE);
+    ymCtx_MemUsage(ctx, nullptr, stats.data());
+    const auto bytes = stats[YmMemStat_Bytes];
+    EXPECT_GT(bytes, 0);
+    EXPECT_EQ(stats[YmMemStat_PeakBytes], bytes);
+    EXPECT_EQ(stats[YmMemStat_Objects], 2);
+    EXPECT_EQ(stats[YmMemStat_Allocations], 2);
+    ymCtx_Pop(ctx, 2);
+    ymCtx_MemUsage(ctx, nullptr, stats.data());
+    EXPECT_EQ(stats[YmMemStat_Bytes], 0);
+    EXPECT_EQ(stats[YmMemStat_PeakBytes], bytes);
+    EXPECT_EQ(stats[YmMemStat_Objects], 0);
+    EXPECT_EQ(stats[YmMemStat_Allocations], 2);
+}
+
+TEST(Contexts, MemUsage_ByType) {
+    SETUP_ALL(ctx);
+    std::array<YmUInt64, YmMemStat_Num> stats{};
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 1), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 2), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutFloat(ctx, YM_PUSH, 3.0), YM_TRUE);
+    ymCtx_MemUsage(ctx, ymCtx_LdInt(ctx), stats.data());
+    EXPECT_GT(stats[YmMemStat_Bytes], 0);
+    EXPECT_EQ(stats[YmMemStat_Objects], 2);
+    EXPECT_EQ(stats[YmMemStat_PeakBytes], 0); // Not gathered per-type.
+    EXPECT_EQ(stats[YmMemStat_Allocations], 0); // Not gathered per-type.
+    ymCtx_MemUsage(ctx, ymCtx_LdFloat(ctx), stats.data());
+    EXPECT_GT(stats[YmMemStat_Bytes], 0);
+    EXPECT_EQ(stats[YmMemStat_Objects], 1);
+    // Types w/out objects have stats of 0.
+    ymCtx_MemUsage(ctx, ymCtx_LdBool(ctx), stats.data());
+    for (const auto& stat : stats) {
+        EXPECT_EQ(stat, 0);
+    }
+}
+
+TEST(Contexts, HeapSnapshot) {
+    SETUP_ALL(ctx);
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 1), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 2), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutFloat(ctx, YM_PUSH, 3.0), YM_TRUE);
+    auto i = ymCtx_Local(ctx, 0, YM_TAKE); // Ref count of 2.
+    auto r = ymCtx_HeapSnapshot(ctx, YM_FALSE);
+    ASSERT_TRUE(r);
+    const std::string snapshot(r);
+    std::free((void*)r);
+    ym::println("{}", snapshot);
+    EXPECT_NE(snapshot.find("\"objects\": 3,"), std::string::npos);
+    EXPECT_NE(snapshot.find("{\"type\": \"yama:Int\", \"objects\": 2, "), std::string::npos);
+    EXPECT_NE(snapshot.find("\"refCounts\": {\"1\": 1, \"2\": 1}"), std::string::npos);
+    EXPECT_NE(snapshot.find("{\"type\": \"yama:Float\", \"objects\": 1, "), std::string::npos);
+    EXPECT_EQ(snapshot.find("\"nodes\""), std::string::npos); // No graph.
+    ymObj_Release(i);
+}
+
+TEST(Contexts, HeapSnapshot_Graph) {
+    SETUP_ALL(ctx);
+    ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 1), YM_TRUE);
+    auto r = ymCtx_HeapSnapshot(ctx, YM_TRUE);
+    ASSERT_TRUE(r);
+    const std::string snapshot(r);
+    std::free((void*)r);
+    ym::println("{}", snapshot);
+    EXPECT_NE(snapshot.find("{\"id\": 0, \"type\": \"yama:Int\", \"refs\": 1}"), std::string::npos);
+    EXPECT_NE(snapshot.find("\"edges\": [\n]"), std::string::npos);
+    EXPECT_NE(snapshot.find("{\"to\": 0, \"kind\": \"local\", \"index\": 0}"), std::string::npos);
+}
+
 namespace {
     inline ErrCounter* _err = nullptr;
     inline size_t observedCalls = 0;
@@ -3002,6 +3345,369 @@ TEST(Contexts, Call_Fail_CallStackOverflow) {
         });
 }
 
+namespace {
+    // Binds parcel p, w/ fns:
+    //      - f, which requests interrupt, then calls g, expecting it to fail.
+    //      - g, which does nothing.
+    //      - spin, which loops until interrupted.
+    void bindInterruptFns(YmDm* dm) {
+        auto p_def = ymParcelDef_Create();
+        ymParcelDef_AddFn(p_def, "f", "yama:None",
+            [](YmCtx* ctx, YmType*, void*) {
+                ymCtx_RequestInterrupt(ctx);
+                EXPECT_EQ(ymCtx_Interrupted(ctx), YM_TRUE);
+                EXPECT_EQ(ymCtx_Call(ctx, ymCtx_Ref(ctx, 0), 0, "", YM_DISCARD), YM_FALSE);
+                // Call of f should still fail, despite returning something.
+                ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+            },
+            nullptr);
+        ymParcelDef_AddRef(p_def, "f", "%here:g");
+        ymParcelDef_AddFn(p_def, "g", "yama:None",
+            [](YmCtx* ctx, YmType*, void*) {
+                ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+            },
+            nullptr);
+        ymParcelDef_AddFn(p_def, "spin", "yama:None",
+            [](YmCtx* ctx, YmType*, void*) {
+                while (ymCtx_Interrupted(ctx) == YM_FALSE) {
+                    std::this_thread::yield();
+                }
+                ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+            },
+            nullptr);
+        ymDm_BindParcelDef(dm, "p", p_def);
+        ymParcelDef_Release(p_def);
+    }
+}
+
+TEST(Contexts, Call_Fail_Interrupted) {
+    SETUP_ALL(ctx);
+    bindInterruptFns(dm);
+    auto f = load(ctx, "p:f");
+    auto g = load(ctx, "p:g");
+
+    EXPECT_EQ(ymCtx_Call(ctx, f, 0, "", YM_DISCARD), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_Interrupted], 2); // Calls of g and f.
+    EXPECT_EQ(ymCtx_CallStackHeight(ctx), 1);
+    EXPECT_EQ(ymCtx_Locals(ctx), 0);
+
+    // Interrupt is cleared upon call stack unwinding.
+    EXPECT_EQ(ymCtx_Interrupted(ctx), YM_FALSE);
+    EXPECT_EQ(ymCtx_Call(ctx, g, 0, "", YM_DISCARD), YM_TRUE);
+}
+
+TEST(Contexts, Call_Fail_Interrupted_NoCallInProgress) {
+    SETUP_ALL(ctx);
+    bindInterruptFns(dm);
+    auto g = load(ctx, "p:g");
+
+    ymCtx_RequestInterrupt(ctx);
+    EXPECT_EQ(ymCtx_Call(ctx, g, 0, "", YM_DISCARD), YM_FALSE); // Next call is interrupted.
+    EXPECT_EQ(err[YmErrCode_Interrupted], 1);
+
+    EXPECT_EQ(ymCtx_Interrupted(ctx), YM_FALSE);
+    EXPECT_EQ(ymCtx_Call(ctx, g, 0, "", YM_DISCARD), YM_TRUE);
+}
+
+TEST(Contexts, Call_Fail_Interrupted_FromAnotherThread) {
+    SETUP_ALL(ctx);
+    bindInterruptFns(dm);
+    auto spin = load(ctx, "p:spin");
+
+    std::jthread other([ctx] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ymCtx_RequestInterrupt(ctx);
+        });
+    EXPECT_EQ(ymCtx_Call(ctx, spin, 0, "", YM_DISCARD), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_Interrupted], 1);
+}
+
+TEST(Contexts, Call_Fail_Interrupted_CallTimeLimitExceeded) {
+    SETUP_ALL(ctx);
+    bindInterruptFns(dm);
+    auto g = load(ctx, "p:g");
+    auto spin = load(ctx, "p:spin");
+
+    ymCtx_SetCallTimeLimit(ctx, 10);
+    EXPECT_EQ(ymCtx_Call(ctx, g, 0, "", YM_DISCARD), YM_TRUE); // Within time limit.
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(ymCtx_Call(ctx, spin, 0, "", YM_DISCARD), YM_FALSE);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(10));
+    EXPECT_EQ(err[YmErrCode_Interrupted], 1);
+
+    // Time limit applies per-call, so it doesn't carry over.
+    EXPECT_EQ(ymCtx_Call(ctx, g, 0, "", YM_DISCARD), YM_TRUE);
+}
+
+namespace {
+    // Binds parcel p, w/ fn hog, which allocates (and keeps) objects until interrupted.
+    void bindHogFn(YmDm* dm) {
+        auto p_def = ymParcelDef_Create();
+        ymParcelDef_AddFn(p_def, "hog", "yama:None",
+            [](YmCtx* ctx, YmType*, void*) {
+                while (ymCtx_Interrupted(ctx) == YM_FALSE) {
+                    ymCtx_PutInt(ctx, YM_PUSH, 0);
+                }
+                ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+            },
+            nullptr);
+        ymDm_BindParcelDef(dm, "p", p_def);
+        ymParcelDef_Release(p_def);
+    }
+}
+
+TEST(Contexts, Call_Fail_MemLimitExceeded) {
+    SETUP_ALL(ctx);
+    bindHogFn(dm);
+    auto hog = load(ctx, "p:hog");
+    ymCtx_SetMemLimit(ctx, 4096);
+
+    EXPECT_EQ(ymCtx_Call(ctx, hog, 0, "", YM_DISCARD), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_MemLimitExceeded], 2); // Allocation which exceeded limit, and call of hog.
+    EXPECT_EQ(ymCtx_Interrupted(ctx), YM_FALSE); // Cleared upon call stack unwinding.
+    std::array<YmUInt64, YmMemStat_Num> stats{};
+    ymCtx_MemUsage(ctx, nullptr, stats.data());
+    EXPECT_LE(stats[YmMemStat_PeakBytes], 4096); // Allocation beyond limit failed.
+    EXPECT_EQ(stats[YmMemStat_Objects], 0); // Objects of hog have been released.
+}
+
+TEST(Contexts, Call_Fail_MemLimitExceeded_NotForObjectsOfUserCallFrame) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddFn(p_def, "f", "yama:None",
+        [](YmCtx* ctx, YmType*, void*) {
+            ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+        },
+        nullptr);
+    ymDm_BindParcelDef(dm, "p", p_def);
+    auto f = load(ctx, "p:f");
+    ymCtx_SetMemLimit(ctx, 64);
+    for (size_t i = 0; i < 100; i++) {
+        ASSERT_EQ(ymCtx_PutInt(ctx, YM_PUSH, 0), YM_TRUE);
+    }
+    EXPECT_EQ(ymCtx_Interrupted(ctx), YM_FALSE);
+
+    // Calls allocating beyond the limit still fail though, even if it was mostly due to us.
+    EXPECT_EQ(ymCtx_Call(ctx, f, 0, "", YM_DISCARD), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_MemLimitExceeded], 2); // Allocation of return value, and call of f.
+
+    ymCtx_SetMemLimit(ctx, 0);
+    EXPECT_EQ(ymCtx_Call(ctx, f, 0, "", YM_DISCARD), YM_TRUE);
+}
+
+namespace {
+    // Suspensions of calls of wait (see bindSuspendFns.)
+    inline std::vector<YmSuspension*> waiting{};
+
+    // Binds parcel p, w/ fns:
+    //      - wait, which suspends, returning 10 upon being resumed.
+    //      - outer, which calls wait, returning its result + 1.
+    //      - g, which does nothing.
+    void bindSuspendFns(YmDm* dm) {
+        waiting.clear();
+        auto p_def = ymParcelDef_Create();
+        ymParcelDef_AddFn(p_def, "wait", "yama:Int",
+            [](YmCtx* ctx, YmType*, void*) {
+                if (ymCtx_Resumed(ctx)) {
+                    ymCtx_Ret(ctx, ymCtx_NewInt(ctx, 10), YM_TAKE);
+                    return;
+                }
+                auto suspension = ymCtx_Suspend(ctx);
+                ASSERT_TRUE(suspension);
+                waiting.push_back(suspension);
+            },
+            nullptr);
+        ymParcelDef_AddFn(p_def, "outer", "yama:Int",
+            [](YmCtx* ctx, YmType*, void*) {
+                if (!ymCtx_Resumed(ctx)) {
+                    ymCtx_PutInt(ctx, YM_PUSH, 1); // Stands in for state to pick up from later.
+                    EXPECT_EQ(ymCtx_Call(ctx, ymCtx_Ref(ctx, 0), 0, "", YM_PUSH), YM_FALSE); // Suspends.
+                    EXPECT_EQ(ymCtx_Call(ctx, ymCtx_Ref(ctx, 1), 0, "", YM_DISCARD), YM_FALSE); // Can't call while suspending.
+                    return;
+                }
+                ASSERT_EQ(ymCtx_Locals(ctx), 2);
+                EXPECT_EQ(ymObj_ToInt(ymCtx_Local(ctx, 0, YM_BORROW), nullptr), 1);
+                auto result = ymObj_ToInt(ymCtx_Local(ctx, 1, YM_BORROW), nullptr);
+                ymCtx_Ret(ctx, ymCtx_NewInt(ctx, result + 1), YM_TAKE);
+            },
+            nullptr);
+        ymParcelDef_AddRef(p_def, "outer", "%here:wait");
+        ymParcelDef_AddRef(p_def, "outer", "%here:g");
+        ymParcelDef_AddFn(p_def, "g", "yama:None",
+            [](YmCtx* ctx, YmType*, void*) {
+                ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+            },
+            nullptr);
+        ymDm_BindParcelDef(dm, "p", p_def);
+        ymParcelDef_Release(p_def);
+    }
+}
+
+TEST(Contexts, SuspendAndResume) {
+    SETUP_ALL(ctx);
+    bindSuspendFns(dm);
+    auto outer = load(ctx, "p:outer");
+    auto g = load(ctx, "p:g");
+
+    EXPECT_EQ(ymCtx_Call(ctx, outer, 0, "", YM_PUSH), YM_FALSE);
+    EXPECT_EQ(ymCtx_Suspended(ctx), YM_TRUE);
+    EXPECT_EQ(ymCtx_CallStackHeight(ctx), 1);
+    EXPECT_EQ(ymCtx_Locals(ctx), 0);
+    EXPECT_EQ(err[YmErrCode_CallProcedureError], 1); // Call of g while suspending.
+    ASSERT_EQ(waiting.size(), 1);
+    auto suspension = waiting[0];
+    auto suspension_ = ym::bindScoped(ym::Safe(suspension));
+    EXPECT_EQ(ymSuspension_RefCount(suspension), 1);
+
+    // Context can be used while call is suspended.
+    EXPECT_EQ(ymCtx_Call(ctx, g, 0, "", YM_DISCARD), YM_TRUE);
+    EXPECT_EQ(ymCtx_Suspended(ctx), YM_FALSE);
+
+    ASSERT_EQ(ymCtx_Resume(ctx, suspension, YM_PUSH), YM_TRUE);
+    EXPECT_EQ(ymCtx_Suspended(ctx), YM_FALSE);
+    EXPECT_EQ(ymCtx_CallStackHeight(ctx), 1);
+    ASSERT_EQ(ymCtx_Locals(ctx), 1);
+    EXPECT_EQ(ymObj_ToInt(ymCtx_Local(ctx, 0, YM_BORROW), nullptr), 11);
+}
+
+TEST(Contexts, SuspendAndResume_Many) {
+    SETUP_ALL(ctx);
+    bindSuspendFns(dm);
+    auto outer = load(ctx, "p:outer");
+
+    constexpr size_t n = 100;
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(ymCtx_Call(ctx, outer, 0, "", YM_DISCARD), YM_FALSE);
+        EXPECT_EQ(ymCtx_Suspended(ctx), YM_TRUE);
+    }
+    ASSERT_EQ(waiting.size(), n);
+    // Resume in reverse order, to ensure suspensions are independent.
+    for (size_t i = n; i-- > 0;) {
+        ASSERT_EQ(ymCtx_Resume(ctx, waiting[i], YM_PUSH), YM_TRUE);
+        ymSuspension_Release(waiting[i]);
+    }
+    ASSERT_EQ(ymCtx_Locals(ctx), n);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(ymObj_ToInt(ymCtx_Local(ctx, YmLocal(i), YM_BORROW), nullptr), 11);
+    }
+}
+
+TEST(Contexts, Suspend_FailQuietly_InUserCallFrame) {
+    SETUP_ALL(ctx);
+    EXPECT_EQ(ymCtx_Suspend(ctx), nullptr);
+}
+
+TEST(Contexts, Resume_Fail_NotResumable_AlreadyResumed) {
+    SETUP_ALL(ctx);
+    bindSuspendFns(dm);
+    auto outer = load(ctx, "p:outer");
+
+    EXPECT_EQ(ymCtx_Call(ctx, outer, 0, "", YM_DISCARD), YM_FALSE);
+    ASSERT_EQ(waiting.size(), 1);
+    auto suspension_ = ym::bindScoped(ym::Safe(waiting[0]));
+    ASSERT_EQ(ymCtx_Resume(ctx, waiting[0], YM_DISCARD), YM_TRUE);
+    EXPECT_EQ(err[YmErrCode_CallProcedureError], 1); // Call of g while suspending.
+
+    EXPECT_EQ(ymCtx_Resume(ctx, waiting[0], YM_DISCARD), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_CallProcedureError], 2);
+}
+
+TEST(Contexts, Resume_Fail_LocalNotFound_ReturnToIsOutOfBounds) {
+    SETUP_ALL(ctx);
+    bindSuspendFns(dm);
+    auto outer = load(ctx, "p:outer");
+
+    EXPECT_EQ(ymCtx_Call(ctx, outer, 0, "", YM_DISCARD), YM_FALSE);
+    ASSERT_EQ(waiting.size(), 1);
+    auto suspension_ = ym::bindScoped(ym::Safe(waiting[0]));
+    EXPECT_EQ(ymCtx_Resume(ctx, waiting[0], 0), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_LocalNotFound], 1);
+
+    // Suspension is still resumable.
+    EXPECT_EQ(ymCtx_Resume(ctx, waiting[0], YM_DISCARD), YM_TRUE);
+}
+
+TEST(Contexts, Suspension_ReleaseWithoutResuming) {
+    SETUP_ALL(ctx);
+    bindSuspendFns(dm);
+    auto outer = load(ctx, "p:outer");
+
+    EXPECT_EQ(ymCtx_Call(ctx, outer, 0, "", YM_DISCARD), YM_FALSE);
+    ASSERT_EQ(waiting.size(), 1);
+    EXPECT_EQ(ymCtx_RefCount(ctx), 2); // Suspension holds a ref.
+    EXPECT_EQ(ymSuspension_Release(waiting[0]), 1); // Destroys, discarding call.
+    EXPECT_EQ(ymCtx_RefCount(ctx), 1);
+}
+
+TEST(Contexts, SuspendAndResume_ProtocolMethod) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddProtocol(p_def, "P");
+    ymParcelDef_AddMethodReq(p_def, "P", "m", "yama:Int");
+    ymParcelDef_AddParam(p_def, "P::m", "self", "$Self");
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddMethod(p_def, "A", "m", "yama:Int",
+        [](YmCtx* ctx, YmType* type, void*) {
+            static YmType* calledVia = nullptr;
+            if (!ymCtx_Resumed(ctx)) {
+                calledVia = type;
+                waiting.push_back(ymCtx_Suspend(ctx));
+                return;
+            }
+            // Should be passed P::m (ie. not A::m) both before and after suspending.
+            EXPECT_EQ(type, calledVia);
+            ymCtx_Ret(ctx, ymCtx_NewInt(ctx, 10), YM_TAKE);
+        },
+        nullptr);
+    ymParcelDef_AddParam(p_def, "A::m", "self", "$Self");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    waiting.clear();
+    auto P_m = load(ctx, "p:P::m");
+
+    ASSERT_EQ(ymCtx_DefaultInit(ctx, load(ctx, "p:A"), YM_PUSH), YM_TRUE);
+    ASSERT_EQ(ymCtx_Convert(ctx, load(ctx, "p:P"), YM_PUSH), YM_TRUE);
+    EXPECT_EQ(ymCtx_Call(ctx, P_m, 1, "", YM_PUSH), YM_FALSE);
+    EXPECT_EQ(ymCtx_Suspended(ctx), YM_TRUE);
+    ASSERT_EQ(waiting.size(), 1);
+    auto suspension_ = ym::bindScoped(ym::Safe(waiting[0]));
+
+    ASSERT_EQ(ymCtx_Resume(ctx, waiting[0], YM_PUSH), YM_TRUE);
+    ASSERT_EQ(ymCtx_Locals(ctx), 1);
+    EXPECT_EQ(ymObj_ToInt(ymCtx_Local(ctx, 0, YM_BORROW), nullptr), 10);
+}
+
+TEST(Contexts, Resume_Fail_Interrupted_CallTimeLimitExceeded) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    // Suspends, then, upon being resumed, loops until interrupted.
+    ymParcelDef_AddFn(p_def, "f", "yama:None",
+        [](YmCtx* ctx, YmType*, void*) {
+            if (!ymCtx_Resumed(ctx)) {
+                waiting.push_back(ymCtx_Suspend(ctx));
+                return;
+            }
+            while (ymCtx_Interrupted(ctx) == YM_FALSE) {
+                std::this_thread::yield();
+            }
+            ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+        },
+        nullptr);
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    waiting.clear();
+    auto f = load(ctx, "p:f");
+
+    ymCtx_SetCallTimeLimit(ctx, 10);
+    EXPECT_EQ(ymCtx_Call(ctx, f, 0, "", YM_DISCARD), YM_FALSE);
+    ASSERT_EQ(waiting.size(), 1);
+    auto suspension_ = ym::bindScoped(ym::Safe(waiting[0]));
+
+    // Time limit applies to the resumed call too.
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(ymCtx_Resume(ctx, waiting[0], YM_DISCARD), YM_FALSE);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(10));
+    EXPECT_EQ(err[YmErrCode_Interrupted], 1);
+}
+
 TEST(Contexts, Ret_Borrow) {
     objsys_test(
         [](YmParcelDef* parceldef) {
@@ -4442,3 +5148,166 @@ TEST(Contexts, Convert_Fail_IllegalConversion) {
         });
 }
 
+
+TEST(Contexts, Marshal) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    SETUP_CTX(src);
+    SETUP_CTX(dst);
+
+    ASSERT_EQ(ymCtx_PutInt(src, YM_PUSH, 13), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutNone(dst, YM_PUSH), YM_TRUE);
+    ASSERT_EQ(ymCtx_Marshal(dst, src, 0), YM_TRUE);
+
+    EXPECT_EQ(ymCtx_Locals(src), 1); // src left unchanged.
+    ASSERT_EQ(ymCtx_Locals(dst), 2);
+    auto original = ymCtx_Local(src, 0, YM_BORROW);
+    auto copy = ymCtx_Local(dst, 1, YM_BORROW);
+    ASSERT_TRUE(copy);
+    EXPECT_NE(copy, original);
+    EXPECT_EQ(ymObj_Type(copy), ymCtx_LdInt(dst));
+    YmBool success{};
+    EXPECT_EQ(ymObj_ToInt(copy, &success), 13);
+    EXPECT_EQ(success, YM_TRUE);
+    EXPECT_EQ(ymObj_RefCount(original), 1);
+    EXPECT_EQ(ymObj_RefCount(copy), 1);
+}
+
+TEST(Contexts, Marshal_Struct) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddStoredProperty(p_def, "A", "a", "yama:Int");
+    ymParcelDef_AddStoredProperty(p_def, "A", "b", "yama:Int");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    SETUP_CTX(src);
+    SETUP_CTX(dst);
+    auto A = load(src, "p:A");
+
+    // a and b are the same object, w/ this sharing being preserved in the copy.
+    SETUP_OBJ(aa, ymCtx_NewInt(src, -4));
+    ymCtx_Put(src, YM_PUSH, aa, YM_BORROW);
+    ymCtx_Put(src, YM_PUSH, aa, YM_BORROW);
+    ASSERT_EQ(ymCtx_StructInit(src, A, "a,b", YM_PUSH), YM_TRUE);
+
+    // Marshalling doesn't need dst to have loaded p:A already.
+    ASSERT_EQ(ymCtx_Marshal(dst, src, -1), YM_TRUE);
+    ASSERT_EQ(ymCtx_Locals(dst), 1);
+    auto copy = ymCtx_Local(dst, 0, YM_BORROW);
+    ASSERT_TRUE(copy);
+    EXPECT_NE(copy, ymCtx_Local(src, 0, YM_BORROW));
+    EXPECT_EQ(ymObj_Type(copy), A);
+    EXPECT_EQ(load(dst, "p:A"), A);
+
+    ymCtx_Put(dst, YM_PUSH, copy, YM_BORROW);
+    ASSERT_EQ(ymCtx_GetProperty(dst, load(dst, "p:A::a"), YM_PUSH), YM_TRUE);
+    ymCtx_Put(dst, YM_PUSH, copy, YM_BORROW);
+    ASSERT_EQ(ymCtx_GetProperty(dst, load(dst, "p:A::b"), YM_PUSH), YM_TRUE);
+    auto a = ymCtx_Local(dst, 1, YM_BORROW);
+    auto b = ymCtx_Local(dst, 2, YM_BORROW);
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, aa);
+    EXPECT_EQ(ymObj_ToInt(a, nullptr), -4);
+    EXPECT_EQ(ymObj_RefCount(a), 4); // Stored as a and b, and two locals.
+    EXPECT_EQ(ymObj_RefCount(aa), 3); // Left unchanged.
+}
+
+TEST(Contexts, Marshal_ProtocolBox) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    SETUP_CTX(src);
+    SETUP_CTX(dst);
+    auto Any = load(src, "yama:Any");
+
+    ASSERT_EQ(ymCtx_PutInt(src, YM_PUSH, 13), YM_TRUE);
+    ASSERT_EQ(ymCtx_Convert(src, Any, YM_PUSH), YM_TRUE);
+
+    ASSERT_EQ(ymCtx_Marshal(dst, src, 0), YM_TRUE);
+    ASSERT_EQ(ymCtx_Locals(dst), 1);
+    EXPECT_EQ(ymObj_Type(ymCtx_Local(dst, 0, YM_BORROW)), Any);
+
+    // Unbox copy to ensure boxed value was copied.
+    ASSERT_EQ(ymCtx_Convert(dst, ymCtx_LdInt(dst), YM_PUSH), YM_TRUE);
+    auto copy = ymCtx_Local(dst, 0, YM_BORROW);
+    EXPECT_EQ(ymObj_Type(copy), ymCtx_LdInt(dst));
+    EXPECT_EQ(ymObj_ToInt(copy, nullptr), 13);
+}
+
+TEST(Contexts, Marshal_SameCtx) {
+    SETUP_ALL(ctx);
+
+    ASSERT_EQ(ymCtx_PutFloat(ctx, YM_PUSH, 3.5), YM_TRUE);
+    ASSERT_EQ(ymCtx_Marshal(ctx, ctx, 0), YM_TRUE);
+
+    ASSERT_EQ(ymCtx_Locals(ctx), 2);
+    EXPECT_NE(ymCtx_Local(ctx, 0, YM_BORROW), ymCtx_Local(ctx, 1, YM_BORROW));
+    EXPECT_EQ(ymObj_ToFloat(ymCtx_Local(ctx, 1, YM_BORROW), nullptr), 3.5);
+}
+
+TEST(Contexts, Marshal_Fail_LocalNotFound_LocalIsOutOfBounds) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    SETUP_CTX(src);
+    SETUP_CTX(dst);
+
+    ASSERT_EQ(ymCtx_PutInt(src, YM_PUSH, 13), YM_TRUE);
+    ASSERT_EQ(ymCtx_Marshal(dst, src, 1), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_LocalNotFound], 1);
+
+    // Ensure stack was left unchanged.
+    EXPECT_EQ(ymCtx_Locals(dst), 0);
+}
+
+TEST(Contexts, Marshal_ForeignDomain) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    SETUP_CTX(src);
+    YmDm* dm2 = ymDm_Create();
+    ASSERT_TRUE(dm2);
+    auto dm2_ = ym::bindScoped(ym::Safe(dm2));
+    YmCtx* dst = ymCtx_Create(dm2);
+    ASSERT_TRUE(dst);
+    auto dst_ = ym::bindScoped(ym::Safe(dst));
+
+    // Builtins are shared by all domains.
+    ASSERT_EQ(ymCtx_PutInt(src, YM_PUSH, 13), YM_TRUE);
+    ASSERT_EQ(ymCtx_Marshal(dst, src, 0), YM_TRUE);
+    ASSERT_EQ(ymCtx_Locals(dst), 1);
+    auto copy = ymCtx_Local(dst, 0, YM_BORROW);
+    EXPECT_EQ(ymObj_Type(copy), ymCtx_LdInt(dst));
+    EXPECT_EQ(ymObj_ToInt(copy, nullptr), 13);
+}
+
+TEST(Contexts, Marshal_Fail_TypeNotFound_DstDomainLacksType) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddStoredProperty(p_def, "A", "a", "yama:Int");
+    ymParcelDef_AddStoredProperty(p_def, "A", "b", "yama:Int");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    SETUP_CTX(src);
+    YmDm* dm2 = ymDm_Create();
+    ASSERT_TRUE(dm2);
+    auto dm2_ = ym::bindScoped(ym::Safe(dm2));
+    YmCtx* dst = ymCtx_Create(dm2);
+    ASSERT_TRUE(dst);
+    auto dst_ = ym::bindScoped(ym::Safe(dst));
+    auto A = load(src, "p:A");
+
+    ASSERT_EQ(ymCtx_PutInt(src, YM_PUSH, 1), YM_TRUE);
+    ASSERT_EQ(ymCtx_PutInt(src, YM_PUSH, 2), YM_TRUE);
+    ASSERT_EQ(ymCtx_StructInit(src, A, "a,b", YM_PUSH), YM_TRUE);
+
+    // dm2 has no p:A, so the copy can't be made.
+    ASSERT_EQ(ymCtx_Marshal(dst, src, -1), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_TypeNotFound], 1);
+
+    // Ensure stack was left unchanged, and no partial copy was left behind.
+    EXPECT_EQ(ymCtx_Locals(dst), 0);
+    YmUInt64 stats[YmMemStat_Num]{};
+    ymCtx_MemUsage(dst, nullptr, stats);
+    EXPECT_EQ(stats[YmMemStat_Objects], 0);
+}
@@ -1,6 +1,12 @@
 ﻿
 
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <taul/strings.h>
@@ -207,3 +213,431 @@ TEST(Domains, ForEachParcel) {
     EXPECT_TRUE(ForEachParcelHelper::visisted.contains(ymCtx_Import(ctx, "f")));
 }
 
+
+TEST(Domains, BuiltinsAreSharedByAllDomains) {
+    SETUP_ALL(ctx);
+    YmDm* dm2 = ymDm_Create();
+    ASSERT_TRUE(dm2);
+    auto dm2_ = ym::bindScoped(ym::Safe(dm2));
+    YmCtx* ctx2 = ymCtx_Create(dm2);
+    ASSERT_TRUE(ctx2);
+    auto ctx2_ = ym::bindScoped(ym::Safe(ctx2));
+    EXPECT_EQ(ymCtx_Import(ctx, "yama"), ymCtx_Import(ctx2, "yama"));
+    EXPECT_EQ(ymCtx_LdNone(ctx), ymCtx_LdNone(ctx2));
+    EXPECT_EQ(ymCtx_LdInt(ctx), ymCtx_LdInt(ctx2));
+    EXPECT_EQ(ymCtx_LdType(ctx), ymCtx_LdType(ctx2));
+    EXPECT_EQ(load(ctx, "yama:Any"), load(ctx2, "yama:Any"));
+    // Builtins are available to domains upon creation.
+    EXPECT_EQ(ymDm_ForEachParcel(dm2, [](YmDm*, void*, YmParcel*, size_t, size_t) {}, nullptr), 1);
+}
+
+TEST(Domains, PreloadAsync) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddStruct(p_def, "B");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    std::vector<YmFullname> fullnames{ "p:A", "p:B", "yama:Int" };
+    ASSERT_EQ(ymDm_PreloadAsync(dm, fullnames.data(), fullnames.size()), YM_TRUE);
+    EXPECT_EQ(ymDm_WaitPreload(dm), YM_TRUE);
+    EXPECT_EQ(ymDm_PreloadDone(dm), YM_TRUE);
+    // Preloading should've imported p and yama into dm.
+    EXPECT_EQ(ymDm_ForEachParcel(dm, [](YmDm*, void*, YmParcel*, size_t, size_t) {}, nullptr), 2);
+    // Loads of preloaded types should go through.
+    YmType* A = load(ctx, "p:A");
+    YmType* B = load(ctx, "p:B");
+    EXPECT_STREQ(ymType_Fullname(A), "p:A");
+    EXPECT_STREQ(ymType_Fullname(B), "p:B");
+}
+
+TEST(Domains, PreloadAsync_NoFullnames) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    EXPECT_EQ(ymDm_PreloadDone(dm), YM_TRUE); // No preloads.
+    EXPECT_EQ(ymDm_WaitPreload(dm), YM_TRUE); // No preloads.
+    ASSERT_EQ(ymDm_PreloadAsync(dm, nullptr, 0), YM_TRUE);
+    EXPECT_EQ(ymDm_WaitPreload(dm), YM_TRUE);
+}
+
+TEST(Domains, PreloadAsync_LoadFailure) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    std::vector<YmFullname> fullnames{ "p:A", "p:Missing" };
+    ASSERT_EQ(ymDm_PreloadAsync(dm, fullnames.data(), fullnames.size()), YM_TRUE);
+    EXPECT_EQ(ymDm_WaitPreload(dm), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_TypeNotFound], 1); // Reported via this thread's err callback.
+    load(ctx, "p:A"); // Loads which succeeded aren't affected.
+}
+
+TEST(Domains, PreloadAsync_IllegalSpecifier) {
+    for (const auto& fullname : illegalFullnames) {
+        SETUP_ERRCOUNTER;
+        SETUP_DM;
+        std::vector<YmFullname> fullnames{ "yama:Int", fullname.c_str() };
+        EXPECT_EQ(ymDm_PreloadAsync(dm, fullnames.data(), fullnames.size()), YM_FALSE) << "fullname == \"" << fullname << "\"";
+        EXPECT_EQ(err[YmErrCode_IllegalSpecifier], 1) << "fullname == \"" << fullname << "\"";
+        EXPECT_EQ(ymDm_WaitPreload(dm), YM_TRUE) << "fullname == \"" << fullname << "\""; // Nothing was preloaded.
+    }
+}
+
+static void setup_for_collect_types_tests(YmDm* dm, YmParcelDef* p_def) {
+    ymAssert(dm != nullptr);
+    ymAssert(p_def != nullptr);
+    ymParcelDef_AddStruct(p_def, "Int");
+    ymParcelDef_AddStruct(p_def, "Float");
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddTypeParam(p_def, "A", "T", "yama:Any");
+    ymParcelDef_AddMethod(p_def, "A", "m", "p:Int", ymInertCallBhvrFn, nullptr);
+    ymParcelDef_AddStruct(p_def, "B");
+    ymParcelDef_AddMethod(p_def, "B", "m", "p:A[p:Float]", ymInertCallBhvrFn, nullptr);
+    ymDm_BindParcelDef(dm, "p", p_def);
+}
+
+TEST(Domains, CollectTypes) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    setup_for_collect_types_tests(dm, p_def);
+    {
+        SETUP_CTX(other);
+        load(other, "p:A[p:Int]");
+        load(other, "p:A[p:Int]::m");
+        load(other, "p:Int"); // Non-generic, so never reclaimed.
+    }
+    // other is gone, so nothing uses p:A[p:Int] (or its member) anymore.
+    EXPECT_EQ(ymDm_CollectTypes(dm), 2);
+    EXPECT_EQ(ymDm_CollectTypes(dm), 0); // Nothing left to reclaim.
+    // Reclaimed types can be reloaded.
+    auto A = load(ctx, "p:A[p:Int]");
+    auto A_m = load(ctx, "p:A[p:Int]::m");
+    EXPECT_EQ(ymType_MemberByName(A, "m"), A_m.get());
+    EXPECT_EQ(ymType_TypeParamByIndex(A, 0), load(ctx, "p:Int").get());
+}
+
+TEST(Domains, CollectTypes_TypesInUseAreNotReclaimed) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    setup_for_collect_types_tests(dm, p_def);
+    auto A = load(ctx, "p:A[p:Int]"); // Used by ctx.
+    auto A_m = ym::Safe(ymType_MemberByName(A, "m")); // Reachable from A.
+    auto B_m = load(ctx, "p:B::m"); // Non-generic, and references p:A[p:Float].
+    EXPECT_EQ(ymDm_CollectTypes(dm), 0);
+    SETUP_CTX(other);
+    EXPECT_EQ(load(other, "p:A[p:Int]").get(), A.get()); // Same type.
+    EXPECT_EQ(load(other, "p:A[p:Int]::m").get(), A_m.get());
+    EXPECT_EQ(load(other, "p:A[p:Float]").get(), ymType_ReturnType(B_m));
+}
+
+TEST(Domains, CollectTypes_PooledCtxsDontKeepTypesInUse) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    setup_for_collect_types_tests(dm, p_def);
+    auto other = ymDm_AcquireCtx(dm);
+    ASSERT_TRUE(other);
+    load(other, "p:A[p:Int]");
+    load(other, "p:A[p:Int]::m");
+    ASSERT_EQ(ymCtx_ReturnToPool(other), 1); // Pooled, rather than destroyed.
+    EXPECT_EQ(ymDm_CollectTypes(dm), 2);
+    // Pooled ctx reloads (rather than resolving the reclaimed types.)
+    other = ymDm_AcquireCtx(dm);
+    ASSERT_TRUE(other);
+    auto A = load(other, "p:A[p:Int]");
+    EXPECT_EQ(ymType_MemberByName(A, "m"), load(other, "p:A[p:Int]::m").get());
+    ymCtx_Release(other);
+}
+
+TEST(Domains, LoadStats) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddMethod(p_def, "A", "m", "p:A", ymInertCallBhvrFn, nullptr);
+    ymDm_BindParcelDef(dm, "p", p_def);
+    std::array<YmUInt64, YmLoadStat_Num> stats{};
+    ymDm_ResetLoadStats(dm);
+    load(ctx, "p:A::m");
+    ymDm_GetLoadStats(dm, stats.data());
+#if defined(YM_LOAD_STATS)
+    EXPECT_GE(stats[YmLoadStat_SpecifiersParsed], 1);
+    EXPECT_EQ(stats[YmLoadStat_TypesGenerated], 2); // p:A and p:A::m
+    EXPECT_GE(stats[YmLoadStat_LateResolutions], 1);
+#else
+    for (const auto& stat : stats) {
+        EXPECT_EQ(stat, 0);
+    }
+#endif
+    ymDm_ResetLoadStats(dm);
+    ymDm_GetLoadStats(dm, stats.data());
+    for (const auto& stat : stats) {
+        EXPECT_EQ(stat, 0);
+    }
+}
+
+static std::string imagePath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+struct RelinkState final {
+    std::vector<std::string> relinked;
+    size_t calls = 0;
+};
+
+static YmBool relinkForTest(void* user, YmPath path, const YmChar* localName, YmCallBhvrCallbackFn* fn, void** fnUser) {
+    auto& state = *(RelinkState*)user;
+    state.relinked.push_back(std::string(path) + ":" + localName);
+    *fn = [](YmCtx* ctx, YmType*, void* user) {
+        (*(size_t*)user)++;
+        ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+        };
+    *fnUser = &state.calls;
+    return YM_TRUE;
+}
+
+TEST(Domains, SaveImageAndLoadImage) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddStoredProperty(p_def, "A", "x", "yama:Int");
+    ymParcelDef_AddMethod(p_def, "A", "m", "p:A", ymInertCallBhvrFn, nullptr);
+    ymParcelDef_AddStruct(p_def, "B");
+    ymParcelDef_AddTypeParam(p_def, "B", "T", "yama:Any");
+    ymParcelDef_AddFn(p_def, "f", "yama:None", [](YmCtx*, YmType*, void*) {}, nullptr);
+    ymParcelDef_AddRef(p_def, "f", "p:B[yama:Int]");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    load(ctx, "p:A");
+    load(ctx, "p:f");
+    const auto path = imagePath("yama-tests-SaveImageAndLoadImage.ymimage");
+    ASSERT_EQ(ymDm_SaveImage(dm, path.c_str()), YM_TRUE);
+
+    YmDm* dm2 = ymDm_Create();
+    ASSERT_TRUE(dm2);
+    auto dm2_ = ym::bindScoped(ym::Safe(dm2));
+    RelinkState state{};
+    EXPECT_EQ(ymDm_LoadImage(dm2, path.c_str(), relinkForTest, &state), YM_TRUE);
+    std::filesystem::remove(path);
+    // Only p:f has a non-builtin call behaviour.
+    EXPECT_EQ(state.relinked, std::vector<std::string>{ "p:f" });
+    // Loading the image should've imported p and yama into dm2.
+    EXPECT_EQ(ymDm_ForEachParcel(dm2, [](YmDm*, void*, YmParcel*, size_t, size_t) {}, nullptr), 2);
+
+    YmCtx* ctx2 = ymCtx_Create(dm2);
+    ASSERT_TRUE(ctx2);
+    auto ctx2_ = ym::bindScoped(ym::Safe(ctx2));
+    YmType* A = load(ctx2, "p:A");
+    YmType* B = load(ctx2, "p:B[yama:Int]");
+    YmType* f = load(ctx2, "p:f");
+    EXPECT_STREQ(ymType_Fullname(A), "p:A");
+    EXPECT_STREQ(ymType_Fullname(B), "p:B[yama:Int]");
+    EXPECT_EQ(ymType_Kind(A), YmKind_Struct);
+    EXPECT_EQ(ymType_Members(A), 2);
+    EXPECT_TRUE(ymType_MemberByName(A, "x"));
+    EXPECT_TRUE(ymType_MemberByName(A, "m"));
+    EXPECT_EQ(ymType_Ref(f, 0), B);
+    EXPECT_EQ(ymCtx_Call(ctx2, f, 0, "", YM_DISCARD), YM_TRUE);
+    EXPECT_EQ(state.calls, 1);
+}
+
+TEST(Domains, SaveImageAndLoadImage_Redirects) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    SETUP_PARCELDEF(r_def);
+    ymParcelDef_AddFn(p_def, "f", "yama:None", ymInertCallBhvrFn, nullptr);
+    ymParcelDef_AddRef(p_def, "f", "q:B");
+    ymParcelDef_AddStruct(r_def, "B");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "r", r_def));
+    ASSERT_TRUE(ymDm_AddRedirect(dm, "p", "q", "r"));
+    load(ctx, "p:f");
+    const auto path = imagePath("yama-tests-SaveImageAndLoadImage_Redirects.ymimage");
+    ASSERT_EQ(ymDm_SaveImage(dm, path.c_str()), YM_TRUE);
+
+    YmDm* dm2 = ymDm_Create();
+    ASSERT_TRUE(dm2);
+    auto dm2_ = ym::bindScoped(ym::Safe(dm2));
+    // p:f can only load if the redirect of q to r was restored.
+    EXPECT_EQ(ymDm_LoadImage(dm2, path.c_str(), nullptr, nullptr), YM_TRUE);
+    std::filesystem::remove(path);
+
+    YmCtx* ctx2 = ymCtx_Create(dm2);
+    ASSERT_TRUE(ctx2);
+    auto ctx2_ = ym::bindScoped(ym::Safe(ctx2));
+    YmType* f = load(ctx2, "p:f");
+    ASSERT_TRUE(f);
+    EXPECT_EQ(ymType_Ref(f, 0), load(ctx2, "r:B"));
+}
+
+TEST(Domains, LoadImage_ImageError_CannotRelinkCallBehaviour) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddFn(p_def, "f", "yama:None", [](YmCtx*, YmType*, void*) {}, nullptr);
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    const auto path = imagePath("yama-tests-LoadImage_ImageError_CannotRelinkCallBehaviour.ymimage");
+    ASSERT_EQ(ymDm_SaveImage(dm, path.c_str()), YM_TRUE);
+
+    YmDm* dm2 = ymDm_Create();
+    ASSERT_TRUE(dm2);
+    auto dm2_ = ym::bindScoped(ym::Safe(dm2));
+    EXPECT_EQ(ymDm_LoadImage(dm2, path.c_str(), nullptr, nullptr), YM_FALSE);
+    std::filesystem::remove(path);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+
+    YmCtx* ctx2 = ymCtx_Create(dm2);
+    ASSERT_TRUE(ctx2);
+    auto ctx2_ = ym::bindScoped(ym::Safe(ctx2));
+    EXPECT_FALSE(ymCtx_Import(ctx2, "p")); // Nothing should've been bound.
+}
+
+TEST(Domains, LoadImage_ImageError_FileNotFound) {
+    SETUP_ALL(ctx);
+    const auto path = imagePath("yama-tests-LoadImage_ImageError_FileNotFound.ymimage");
+    std::filesystem::remove(path);
+    EXPECT_EQ(ymDm_LoadImage(dm, path.c_str(), nullptr, nullptr), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(Domains, LoadImage_ImageError_NotAnImage) {
+    SETUP_ALL(ctx);
+    const auto path = imagePath("yama-tests-LoadImage_ImageError_NotAnImage.ymimage");
+    std::ofstream(path) << "not an image";
+    EXPECT_EQ(ymDm_LoadImage(dm, path.c_str(), nullptr, nullptr), YM_FALSE);
+    std::filesystem::remove(path);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(Domains, LoadImage_ImageError_Malformed) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    load(ctx, "p:A");
+    const auto path = imagePath("yama-tests-LoadImage_ImageError_Malformed.ymimage");
+    ASSERT_EQ(ymDm_SaveImage(dm, path.c_str()), YM_TRUE);
+    // Truncate the image.
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+    YmDm* dm2 = ymDm_Create();
+    ASSERT_TRUE(dm2);
+    auto dm2_ = ym::bindScoped(ym::Safe(dm2));
+    EXPECT_EQ(ymDm_LoadImage(dm2, path.c_str(), nullptr, nullptr), YM_FALSE);
+    std::filesystem::remove(path);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+// Saves an image of dm, corrupts it by replacing each occurrence of before in it w/ after (which
+// must be of the same length, so the layout of the image is unchanged), and then loads it into
+// a new domain, returning the result.
+static YmBool loadCorruptedImage(YmDm* dm, const char* name, std::string_view before, std::string_view after) {
+    EXPECT_EQ(before.size(), after.size());
+    const auto path = imagePath(name);
+    EXPECT_EQ(ymDm_SaveImage(dm, path.c_str()), YM_TRUE);
+    std::string data{};
+    {
+        std::ifstream f(path, std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(f), {});
+    }
+    size_t replaced = 0;
+    for (size_t i = data.find(before); i != std::string::npos; i = data.find(before, i + after.size())) {
+        data.replace(i, before.size(), after);
+        replaced++;
+    }
+    EXPECT_GE(replaced, 1);
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << data;
+
+    YmDm* dm2 = ymDm_Create();
+    EXPECT_TRUE(dm2);
+    auto dm2_ = ym::bindScoped(ym::Safe(dm2));
+    const YmBool result = ymDm_LoadImage(dm2, path.c_str(), nullptr, nullptr);
+    std::filesystem::remove(path);
+    return result;
+}
+
+TEST(Domains, LoadImage_ImageError_IllegalPath) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "pkg", p_def));
+    load(ctx, "pkg:A");
+
+    EXPECT_EQ(loadCorruptedImage(dm, "yama-tests-LoadImage_ImageError_IllegalPath.ymimage", "pkg", "p:g"), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(Domains, LoadImage_ImageError_IllegalLocalName) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "Alpha");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+
+    EXPECT_EQ(loadCorruptedImage(dm, "yama-tests-LoadImage_ImageError_IllegalLocalName.ymimage", "Alpha", "Al-ha"), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(Domains, LoadImage_ImageError_IllegalMemberName) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddMethod(p_def, "A", "Selg", "p:A", ymInertCallBhvrFn, nullptr);
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+
+    // Members cannot be named Self.
+    EXPECT_EQ(loadCorruptedImage(dm, "yama-tests-LoadImage_ImageError_IllegalMemberName.ymimage", "Selg", "Self"), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(Domains, LoadImage_ImageError_IllegalParamName) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddFn(p_def, "f", "yama:None", ymInertCallBhvrFn, nullptr);
+    ymParcelDef_AddParam(p_def, "f", "alpha", "yama:Int");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+
+    EXPECT_EQ(loadCorruptedImage(dm, "yama-tests-LoadImage_ImageError_IllegalParamName.ymimage", "alpha", "1lpha"), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(Domains, LoadImage_ImageError_IllegalTypeParamName) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddTypeParam(p_def, "A", "Alpha", "yama:Any");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+
+    EXPECT_EQ(loadCorruptedImage(dm, "yama-tests-LoadImage_ImageError_IllegalTypeParamName.ymimage", "Alpha", "Al ha"), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(Domains, LoadImage_ImageError_IllegalRefSymbol) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddFn(p_def, "f", "yama:None", ymInertCallBhvrFn, nullptr);
+    ymParcelDef_AddRef(p_def, "f", "p:A");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+
+    // No types are loaded, so p:A only occurs in the image as a ref symbol.
+    EXPECT_EQ(loadCorruptedImage(dm, "yama-tests-LoadImage_ImageError_IllegalRefSymbol.ymimage", "p:A", ":pA"), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(Domains, LoadImage_ImageError_IllegalFullname) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "p", p_def));
+    load(ctx, "p:A");
+
+    // p:A only occurs in the image as the fullname of a loaded type.
+    EXPECT_EQ(loadCorruptedImage(dm, "yama-tests-LoadImage_ImageError_IllegalFullname.ymimage", "p:A", ":pA"), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(Domains, LoadImage_PathBindError_WouldOverwriteYamaParcel) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ASSERT_TRUE(ymDm_BindParcelDef(dm, "yamb", p_def));
+
+    // Parcels of images are bound w/ the same checks as ymDm_BindParcelDef.
+    EXPECT_EQ(loadCorruptedImage(dm, "yama-tests-LoadImage_PathBindError_WouldOverwriteYamaParcel.ymimage", "yamb", "yama"), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_PathBindError], 1);
+}
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <yama/yama.h>
+
+#include "../utils/utils.h"
+
+
+namespace {
+    // Binds parcel p, w/ fn add(a: Int, b: Int) -> Int, to dm.
+    void bindAdd(YmDm* dm) {
+        auto p_def = ymParcelDef_Create();
+        ymParcelDef_AddFn(p_def, "add", "yama:Int",
+            [](YmCtx* ctx, YmType*, void*) {
+                auto a = ymObj_ToInt(ymCtx_Arg(ctx, 0, YM_BORROW), nullptr);
+                auto b = ymObj_ToInt(ymCtx_Arg(ctx, 1, YM_BORROW), nullptr);
+                ymCtx_Ret(ctx, ymCtx_NewInt(ctx, a + b), YM_TAKE);
+            },
+            nullptr);
+        ymParcelDef_AddParam(p_def, "add", "a", "yama:Int");
+        ymParcelDef_AddParam(p_def, "add", "b", "yama:Int");
+        ymParcelDef_AddFn(p_def, "none", "yama:None",
+            [](YmCtx* ctx, YmType*, void*) {
+                ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+            },
+            nullptr);
+        ymDm_BindParcelDef(dm, "p", p_def);
+        ymParcelDef_Release(p_def);
+    }
+
+    struct Results final {
+        std::mutex lock;
+        std::vector<YmInt> values;
+        std::atomic<size_t> failures = 0;
+
+
+        static void callback(void* user, YmBool succeeded, const YmPrimitive* result) {
+            auto& self = *(Results*)user;
+            if (!succeeded) {
+                self.failures++;
+                return;
+            }
+            ASSERT_TRUE(result);
+            ASSERT_EQ(result->kind, YmPrimitiveKind_Int);
+            std::scoped_lock lk(self.lock);
+            self.values.push_back(result->i);
+        }
+    };
+}
+
+
+TEST(Executors, CreateAndDestroy) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    auto executor = ymExecutor_Create(dm, 2);
+    ASSERT_TRUE(executor);
+    EXPECT_EQ(ymExecutor_RefCount(executor), 1);
+    EXPECT_EQ(ymExecutor_Workers(executor), 2);
+    EXPECT_EQ(ymDm_RefCount(dm), 2); // Executor holds a ref.
+    EXPECT_EQ(ymExecutor_Release(executor), 1); // Destroys
+    EXPECT_EQ(ymDm_RefCount(dm), 1);
+}
+
+TEST(Executors, CreateAndDestroy_WorkerPerHardwareThread) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    auto executor = ymExecutor_Create(dm, 0);
+    ASSERT_TRUE(executor);
+    auto executor_ = ym::bindScoped(ym::Safe(executor));
+    EXPECT_GE(ymExecutor_Workers(executor), 1);
+}
+
+TEST(Executors, Submit) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    bindAdd(dm);
+    auto executor = ymExecutor_Create(dm, 4);
+    ASSERT_TRUE(executor);
+    auto executor_ = ym::bindScoped(ym::Safe(executor));
+    Results results{};
+    constexpr YmInt jobs = 1000;
+    for (YmInt i = 0; i < jobs; i++) {
+        const YmPrimitive args[] = {
+            { .kind = YmPrimitiveKind_Int, .i = i },
+            { .kind = YmPrimitiveKind_Int, .i = 1 },
+        };
+        ASSERT_EQ(ymExecutor_Submit(executor, "p:add", args, 2, "", Results::callback, &results), YM_TRUE);
+    }
+    ymExecutor_Wait(executor);
+    EXPECT_EQ(results.failures, 0);
+    ASSERT_EQ(results.values.size(), jobs);
+    std::sort(results.values.begin(), results.values.end());
+    for (YmInt i = 0; i < jobs; i++) {
+        EXPECT_EQ(results.values[size_t(i)], i + 1);
+    }
+}
+
+TEST(Executors, Submit_NonIntResult) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    bindAdd(dm);
+    auto executor = ymExecutor_Create(dm, 1);
+    ASSERT_TRUE(executor);
+    auto executor_ = ym::bindScoped(ym::Safe(executor));
+    static std::atomic<bool> called = false;
+    ASSERT_EQ(ymExecutor_Submit(executor, "p:none", nullptr, 0, "",
+        [](void*, YmBool succeeded, const YmPrimitive* result) {
+            called = true;
+            EXPECT_EQ(succeeded, YM_TRUE);
+            ASSERT_TRUE(result);
+            EXPECT_EQ(result->kind, YmPrimitiveKind_None);
+        },
+        nullptr), YM_TRUE);
+    ymExecutor_Wait(executor);
+    EXPECT_TRUE(called);
+}
+
+TEST(Executors, Submit_JobFails) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    bindAdd(dm);
+    auto executor = ymExecutor_Create(dm, 1);
+    ASSERT_TRUE(executor);
+    auto executor_ = ym::bindScoped(ym::Safe(executor));
+    Results results{};
+    const YmPrimitive args[] = {
+        { .kind = YmPrimitiveKind_Int, .i = 1 },
+    };
+    ASSERT_EQ(ymExecutor_Submit(executor, "p:missing", nullptr, 0, "", Results::callback, &results), YM_TRUE);
+    ymExecutor_Wait(executor);
+    ASSERT_EQ(ymExecutor_Submit(executor, "p:add", args, 1, "", Results::callback, &results), YM_TRUE); // Too few args.
+    ymExecutor_Wait(executor);
+    EXPECT_EQ(results.failures, 2);
+    EXPECT_TRUE(results.values.empty());
+    // Errors are raised via the err callback of the submitting thread.
+    EXPECT_EQ(err[YmErrCode_TypeNotFound], 1);
+    EXPECT_EQ(err[YmErrCode_CallProcedureError], 1);
+}
+
+TEST(Executors, Submit_IllegalSpecifier) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    auto executor = ymExecutor_Create(dm, 1);
+    ASSERT_TRUE(executor);
+    auto executor_ = ym::bindScoped(ym::Safe(executor));
+    EXPECT_EQ(ymExecutor_Submit(executor, "/", nullptr, 0, "", nullptr, nullptr), YM_FALSE);
+    EXPECT_EQ(err[YmErrCode_IllegalSpecifier], 1);
+}
+
+TEST(Executors, Release_WaitsForJobs) {
+    SETUP_ERRCOUNTER;
+    SETUP_DM;
+    bindAdd(dm);
+    auto executor = ymExecutor_Create(dm, 2);
+    ASSERT_TRUE(executor);
+    Results results{};
+    const YmPrimitive args[] = {
+        { .kind = YmPrimitiveKind_Int, .i = 1 },
+        { .kind = YmPrimitiveKind_Int, .i = 2 },
+    };
+    for (size_t i = 0; i < 100; i++) {
+        ASSERT_EQ(ymExecutor_Submit(executor, "p:add", args, 2, "", Results::callback, &results), YM_TRUE);
+    }
+    ymExecutor_Release(executor);
+    EXPECT_EQ(results.values.size(), 100);
+}
+
@@ -1,6 +1,9 @@
 ﻿
 
+#include <algorithm>
 #include <format>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <taul/strings.h>
@@ -2089,3 +2092,222 @@ TEST(ParcelDefs, AddRef_IllegalSpecifier) {
     }
 }
 
+TEST(ParcelDefs, AddBulk) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    static const YmParamDesc B_typeParams[] = { { "T", "yama:Any" } };
+    static const YmParamDesc f_params[] = { { "a", "yama:Int" } };
+    static const YmParamDesc f_namedParams[] = { { "b", "yama:Float" } };
+    static const YmRefSym f_refs[] = { "%here:B[%here:A]" };
+    static const YmParamDesc A_m_params[] = { { "a", "$Self" } };
+    static const YmTypeDesc descs[] = {
+        { .kind = YmTypeDescKind_Struct, .name = "A" },
+        { .kind = YmTypeDescKind_StoredProperty, .ownerName = "A", .name = "x", .type = "yama:Int" },
+        { .kind = YmTypeDescKind_Method, .ownerName = "A", .name = "m", .type = "yama:None", .behaviour = ymInertCallBhvrFn, .params = A_m_params, .paramsN = 1 },
+        { .kind = YmTypeDescKind_Struct, .name = "B", .typeParams = B_typeParams, .typeParamsN = 1 },
+        { .kind = YmTypeDescKind_Fn, .name = "f", .type = "yama:None", .behaviour = ymInertCallBhvrFn,
+          .params = f_params, .paramsN = 1, .namedParams = f_namedParams, .namedParamsN = 1, .refs = f_refs, .refsN = 1 },
+        { .kind = YmTypeDescKind_StoredVar, .name = "v", .type = "yama:Int", .behaviour = ymInertCallBhvrFn },
+    };
+    ASSERT_EQ(ymParcelDef_AddBulk(p_def, descs, std::size(descs)), std::size(descs));
+    ASSERT_EQ(ymDm_BindParcelDef(dm, "p", p_def), YM_TRUE);
+
+    YmType* A = load(ctx, "p:A");
+    YmType* B = load(ctx, "p:B[p:A]");
+    YmType* f = load(ctx, "p:f");
+    YmType* v = load(ctx, "p:v");
+    ASSERT_TRUE(ymType_MemberByName(A, "x"));
+    ASSERT_TRUE(ymType_MemberByName(A, "m"));
+    EXPECT_EQ(ymType_Kind(ymType_MemberByName(A, "x")), YmKind_Property);
+    EXPECT_EQ(ymType_Params(ymType_MemberByName(A, "m"), YM_TRUE), 1);
+    EXPECT_EQ(ymType_TypeParams(B), 1);
+    EXPECT_EQ(ymType_TypeParamByName(B, "T"), A);
+    EXPECT_EQ(ymType_Params(f, YM_FALSE), 1);
+    EXPECT_EQ(ymType_Params(f, YM_TRUE), 2);
+    EXPECT_STREQ(ymType_ParamName(f, 1), "b");
+    EXPECT_EQ(ymType_ParamCategory(f, 1), YmParamCategory_Named);
+    EXPECT_EQ(ymType_Ref(f, 0), B);
+    EXPECT_EQ(ymType_Kind(v), YmKind_Var);
+}
+
+TEST(ParcelDefs, AddBulk_NoDescs) {
+    SETUP_ERRCOUNTER;
+    SETUP_PARCELDEF(p_def);
+    EXPECT_EQ(ymParcelDef_AddBulk(p_def, nullptr, 0), 0);
+}
+
+TEST(ParcelDefs, AddBulk_StopsAtFirstFailure) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    static const YmTypeDesc descs[] = {
+        { .kind = YmTypeDescKind_Struct, .name = "A" },
+        { .kind = YmTypeDescKind_Struct, .name = "0B" }, // Illegal name.
+        { .kind = YmTypeDescKind_Struct, .name = "C" },
+    };
+    EXPECT_EQ(ymParcelDef_AddBulk(p_def, descs, std::size(descs)), 1);
+    EXPECT_EQ(err[YmErrCode_IllegalName], 1);
+    ASSERT_EQ(ymDm_BindParcelDef(dm, "p", p_def), YM_TRUE);
+    EXPECT_TRUE(ymCtx_Load(ctx, "p:A"));
+    EXPECT_FALSE(ymCtx_Load(ctx, "p:C"));
+}
+
+TEST(ParcelDefs, AddBulk_FailsIfParamFails) {
+    SETUP_ERRCOUNTER;
+    SETUP_PARCELDEF(p_def);
+    static const YmParamDesc f_params[] = { { "a", "yama:Int" }, { "a", "yama:Int" } }; // Name conflict.
+    static const YmTypeDesc descs[] = {
+        { .kind = YmTypeDescKind_Fn, .name = "f", .type = "yama:None", .behaviour = ymInertCallBhvrFn, .params = f_params, .paramsN = 2 },
+        { .kind = YmTypeDescKind_Struct, .name = "A" },
+    };
+    EXPECT_EQ(ymParcelDef_AddBulk(p_def, descs, std::size(descs)), 0);
+    EXPECT_EQ(err[YmErrCode_NameConflict], 1);
+}
+
+TEST(ParcelDefs, AddBulk_FailsIfNamedParamsNotAllowed) {
+    SETUP_ERRCOUNTER;
+    SETUP_PARCELDEF(p_def);
+    static const YmParamDesc P_m_namedParams[] = { { "a", "yama:Int" } };
+    static const YmTypeDesc descs[] = {
+        { .kind = YmTypeDescKind_Protocol, .name = "P" },
+        { .kind = YmTypeDescKind_MethodReq, .ownerName = "P", .name = "m", .type = "yama:None", .namedParams = P_m_namedParams, .namedParamsN = 1 },
+    };
+    EXPECT_EQ(ymParcelDef_AddBulk(p_def, descs, std::size(descs)), 1);
+    EXPECT_EQ(err[YmErrCode_ProtocolMemberType], 1);
+}
+
+static std::vector<char> serialize(YmParcelDef* parceldef) {
+    std::vector<char> result(ymParcelDef_Serialize(parceldef, nullptr, 0));
+    if (!result.empty()) {
+        EXPECT_EQ(ymParcelDef_Serialize(parceldef, result.data(), result.size()), result.size());
+    }
+    return result;
+}
+
+static YmBool relinkByLocalName(void* user, YmPath path, const YmChar* localName, YmCallBhvrCallbackFn* fn, void** fnUser) {
+    EXPECT_EQ(path, nullptr);
+    (*(std::vector<std::string>*)user).push_back(localName);
+    *fn = [](YmCtx* ctx, YmType*, void*) {
+        ymCtx_Ret(ctx, ymCtx_NewNone(ctx), YM_TAKE);
+        };
+    *fnUser = nullptr;
+    return YM_TRUE;
+}
+
+TEST(ParcelDefs, SerializeAndDeserialize) {
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddStoredProperty(p_def, "A", "x", "yama:Int");
+    ymParcelDef_AddMethod(p_def, "A", "m", "%here:A", ymInertCallBhvrFn, nullptr);
+    ymParcelDef_AddProtocol(p_def, "P");
+    ymParcelDef_AddMethodReq(p_def, "P", "m", "$Self");
+    ymParcelDef_AddStruct(p_def, "B");
+    ymParcelDef_AddTypeParam(p_def, "B", "T", "%here:P");
+    ymParcelDef_AddFn(p_def, "f", "yama:None", [](YmCtx*, YmType*, void*) {}, nullptr);
+    ymParcelDef_AddParam(p_def, "f", "a", "yama:Int");
+    ymParcelDef_BeginNamedParams(p_def, "f");
+    ymParcelDef_AddParam(p_def, "f", "b", "yama:Float");
+    ymParcelDef_AddRef(p_def, "f", "%here:B[%here:A]");
+    ymParcelDef_AddStoredVar(p_def, "v", "yama:Int", [](YmCtx*, YmType*, void*) {}, nullptr);
+    const auto data = serialize(p_def);
+    ASSERT_FALSE(data.empty());
+
+    std::vector<std::string> relinked{};
+    YmParcelDef* q_def = ymParcelDef_Deserialize(data.data(), data.size(), relinkByLocalName, &relinked);
+    ASSERT_TRUE(q_def);
+    auto q_def_ = ym::bindScoped(ym::Safe(q_def));
+    EXPECT_EQ(ymParcelDef_RefCount(q_def), 1);
+    // Only f and v$init have non-builtin call behaviours.
+    EXPECT_EQ(relinked, (std::vector<std::string>{ "f", "v$init" }));
+    ASSERT_EQ(ymDm_BindParcelDef(dm, "q", q_def), YM_TRUE);
+
+    YmType* A = load(ctx, "q:A");
+    YmType* B = load(ctx, "q:B[q:A]");
+    YmType* f = load(ctx, "q:f");
+    YmType* v = load(ctx, "q:v");
+    EXPECT_EQ(ymType_Members(A), 2);
+    EXPECT_EQ(ymType_Kind(ymType_MemberByName(A, "x")), YmKind_Property);
+    EXPECT_EQ(ymType_Kind(ymType_MemberByName(A, "m")), YmKind_Method);
+    EXPECT_EQ(ymType_TypeParams(B), 1);
+    EXPECT_EQ(ymType_TypeParamByName(B, "T"), A);
+    EXPECT_EQ(ymType_Params(f, YM_FALSE), 1);
+    EXPECT_EQ(ymType_Params(f, YM_TRUE), 2);
+    EXPECT_STREQ(ymType_ParamName(f, 1), "b");
+    EXPECT_EQ(ymType_ParamCategory(f, 1), YmParamCategory_Named);
+    EXPECT_EQ(ymType_ParamType(f, 1), ymCtx_LdFloat(ctx));
+    EXPECT_EQ(ymType_Ref(f, 0), B);
+    EXPECT_EQ(ymType_Kind(v), YmKind_Var);
+    EXPECT_EQ(ymType_ReturnType(v), ymCtx_LdInt(ctx));
+}
+
+TEST(ParcelDefs, Serialize_QueryingSizeWritesNothing) {
+    SETUP_ERRCOUNTER;
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    const size_t size = ymParcelDef_Serialize(p_def, nullptr, 0);
+    ASSERT_GT(size, 0);
+    std::vector<char> buffer(size - 1, '\0');
+    EXPECT_EQ(ymParcelDef_Serialize(p_def, buffer.data(), buffer.size()), size);
+    EXPECT_EQ(buffer, std::vector<char>(size - 1, '\0'));
+}
+
+TEST(ParcelDefs, Deserialize_ImageError_NotSerializedParcelDef) {
+    SETUP_ERRCOUNTER;
+    const std::string data = "not a parcel def";
+    EXPECT_FALSE(ymParcelDef_Deserialize(data.data(), data.size(), nullptr, nullptr));
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(ParcelDefs, Deserialize_ImageError_Malformed) {
+    SETUP_ERRCOUNTER;
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    const auto data = serialize(p_def);
+    ASSERT_FALSE(data.empty());
+    // Truncated.
+    EXPECT_FALSE(ymParcelDef_Deserialize(data.data(), data.size() - 1, nullptr, nullptr));
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(ParcelDefs, Deserialize_ImageError_CannotRelinkCallBehaviour) {
+    SETUP_ERRCOUNTER;
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddFn(p_def, "f", "yama:None", [](YmCtx*, YmType*, void*) {}, nullptr);
+    const auto data = serialize(p_def);
+    ASSERT_FALSE(data.empty());
+    EXPECT_FALSE(ymParcelDef_Deserialize(data.data(), data.size(), nullptr, nullptr));
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+// Deserializes data, w/ the first occurrence of before in it replaced by after
+// (which must be of equal length, so as to not disturb anything else.)
+static YmParcelDef* deserializeCorrupted(std::vector<char> data, std::string_view before, std::string_view after) {
+    const auto it = std::search(data.begin(), data.end(), before.begin(), before.end());
+    if (it == data.end() || before.size() != after.size()) {
+        ADD_FAILURE() << "Cannot corrupt data!";
+        return nullptr;
+    }
+    std::copy(after.begin(), after.end(), it);
+    return ymParcelDef_Deserialize(data.data(), data.size(), nullptr, nullptr);
+}
+
+TEST(ParcelDefs, Deserialize_ImageError_IllegalName) {
+    SETUP_ERRCOUNTER;
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "Alpha");
+    const auto data = serialize(p_def);
+    ASSERT_FALSE(data.empty());
+    EXPECT_FALSE(deserializeCorrupted(data, "Alpha", "Al-ha"));
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
+
+TEST(ParcelDefs, Deserialize_ImageError_IllegalRefSymbol) {
+    SETUP_ERRCOUNTER;
+    SETUP_PARCELDEF(p_def);
+    ymParcelDef_AddStruct(p_def, "A");
+    ymParcelDef_AddStoredProperty(p_def, "A", "x", "yama:Int");
+    const auto data = serialize(p_def);
+    ASSERT_FALSE(data.empty());
+    EXPECT_FALSE(deserializeCorrupted(data, "yama:Int", "yama:In["));
+    EXPECT_EQ(err[YmErrCode_ImageError], 1);
+}
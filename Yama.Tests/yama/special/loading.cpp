@@ -1,5 +1,8 @@
 
 
+#include <thread>
+#include <vector>
+
 #include "loading-helpers.h"
 
 
@@ -982,6 +985,42 @@ TEST(Loading, TypeParams_RecursiveConstraint_ForGenericNonProtocol_Illegal) {
     EXPECT_EQ(err[YmErrCode_NonProtocolType], 1);
 }
 
+TEST(Loading, TypeParams_ManyTypeArgs) {
+    // NOTE: Enough types are loaded here that constraint checking is split up across worker threads.
+    // Generics:
+    //      T[X: P]
+    // 
+    // Dep Graph:
+    //      p:Root      -> p:T[p:A0], p:T[p:A1], ..., p:T[p:A99]
+    // 
+    //      p:T[p:Ai]   -> p:Ai     (X == p:Ai; p:Ai conforms to p:P.)
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+
+    setup_struct(p_def, "Int", {});
+
+    setup_protocol(p_def, "P", {});
+    ymParcelDef_AddMethodReq(p_def, "P", "m", "p:Int");
+
+    setup_struct(p_def, "T", {}, { { "X", "p:P" } });
+
+    setup_struct(p_def, "Root", {});
+    for (size_t i = 0; i < 100; i++) {
+        const auto name = std::format("A{}", i);
+        setup_struct(p_def, name, {});
+        setup_method(p_def, name, "m", "p:Int", {});
+        ymParcelDef_AddRef(p_def, "Root", std::format("p:T[p:{}]", name).c_str());
+    }
+
+    ymDm_BindParcelDef(dm, "p", p_def);
+
+    auto Root = load(ctx, "p:Root");
+    ASSERT_TRUE(Root);
+    for (size_t i = 0; i < 100; i++) {
+        EXPECT_EQ(ymType_Depends(Root, load(ctx, std::format("p:T[p:A{}]", i))), YM_TRUE);
+    }
+}
+
 TEST(Loading, MemberAccess) {
     SETUP_ALL(ctx);
     SETUP_PARCELDEF(p_def);
@@ -1031,6 +1070,75 @@ TEST(Loading, MemberAccess_SelfAndTypeParamRefs) {
     EXPECT_EQ(ymType_Ref(A_B, B_m2_ref), B_m2);
 }
 
+TEST(Loading, MemberAccess_ConcurrentFirstAccess) {
+    // NOTE: Members are materialized upon first access, so this tests that concurrent
+    //       first accesses from different threads agree upon the member.
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+
+    setup_struct(p_def, "A", {});
+    setup_method(p_def, "A", "m", "p:B", { "$Self" });
+    setup_struct(p_def, "B", {});
+
+    ymDm_BindParcelDef(dm, "p", p_def);
+
+    auto A = load(ctx, "p:A");
+    ASSERT_TRUE(A);
+
+    std::vector<YmType*> results(8, nullptr);
+    std::vector<std::thread> threads{};
+    for (auto& result : results) {
+        threads.emplace_back([A, &result]() {
+            result = ymType_MemberByName(A, "m");
+            });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto A_m = load(ctx, "p:A::m");
+    ASSERT_TRUE(A_m);
+    for (const auto& result : results) {
+        EXPECT_EQ(result, A_m);
+    }
+    EXPECT_EQ(ymType_ReturnType(A_m), load(ctx, "p:B"));
+    EXPECT_EQ(ymType_Owner(A_m), A);
+}
+
+TEST(Loading, MemberAccess_RebindBeforeFirstAccess) {
+    // NOTE: Members are materialized upon first access, so this tests that rebinding the
+    //       parcels they depend upon beforehand doesn't change what they resolve to, nor
+    //       cause their materialization to fail.
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    SETUP_PARCELDEF(q_def);
+    SETUP_PARCELDEF(p_def2);
+    SETUP_PARCELDEF(q_def2);
+
+    setup_struct(p_def, "A", {});
+    setup_method(p_def, "A", "m", "q:B", { "%here:C" });
+    setup_struct(p_def, "C", {});
+    setup_struct(q_def, "B", {});
+
+    ymDm_BindParcelDef(dm, "p", p_def);
+    ymDm_BindParcelDef(dm, "q", q_def);
+
+    auto A = load(ctx, "p:A");
+    ASSERT_TRUE(A);
+
+    // Neither p:A::m, nor its deps, exist in these.
+    setup_struct(p_def2, "A", {});
+    ymDm_BindParcelDef(dm, "p", p_def2);
+    ymDm_BindParcelDef(dm, "q", q_def2);
+
+    auto A_m = ymType_MemberByName(A, "m");
+    ASSERT_TRUE(A_m);
+    EXPECT_EQ(ymType_Owner(A_m), A);
+    EXPECT_EQ(ymType_ReturnType(A_m), load(ctx, "q:B"));
+    EXPECT_EQ(ymType_Ref(A_m, 0), load(ctx, "p:C"));
+    EXPECT_EQ(err[YmErrCode_TypeNotFound], 0);
+    EXPECT_EQ(err[YmErrCode_ParcelNotFound], 0);
+}
+
 // TODO: What about situation where callsig load fails due to attempt to use callsig w/
 //       a GENERIC type W/OUT type arguments? Our tests don't cover things like that.
 
@@ -1225,6 +1333,49 @@ TEST(Loading, Fail_TypeNotFound_IndirectLoad_MemberOfSelf) {
     EXPECT_EQ(err[YmErrCode_TypeNotFound], 1);
 }
 
+TEST(Loading, Fail_TypeNotFound_IndirectLoad_ViaMember) {
+    // NOTE: Members are materialized lazily, so this tests that their deps are
+    //       nevertheless checked upon loading of their owner.
+
+    // Dep Graph:
+    //      p:A     -> $Self::m     (Member)
+    //      p:A::m  -> q:A          (q does exist, but q:A doesn't.)
+
+    // NOTE: Don't call ymCtx_Load for any type before the initial p:A load, so that
+    //       it's recursive loading of others is properly tested.
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+    SETUP_PARCELDEF(q_def);
+
+    setup_struct(p_def, "A", {});
+    setup_method(p_def, "A", "m", "q:A", {});
+    
+    ymDm_BindParcelDef(dm, "p", p_def);
+    ymDm_BindParcelDef(dm, "q", q_def);
+
+    EXPECT_EQ(ymCtx_Load(ctx, "p:A"), nullptr);
+    EXPECT_EQ(err[YmErrCode_TypeNotFound], 1);
+}
+
+TEST(Loading, Fail_TypeNotFound_IndirectLoad_MemberOfSelf_ViaMember) {
+    // Dep Graph:
+    //      p:A     -> $Self::m1    (Member)
+    //      p:A::m1 -> $Self::m2    (p:A does exist, but $Self::m2 doesn't.)
+
+    // NOTE: Don't call ymCtx_Load for any type before the initial p:A load, so that
+    //       it's recursive loading of others is properly tested.
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+
+    setup_struct(p_def, "A", {});
+    setup_method(p_def, "A", "m1", "p:A", { "$Self::m2" });
+    
+    ymDm_BindParcelDef(dm, "p", p_def);
+
+    EXPECT_EQ(ymCtx_Load(ctx, "p:A"), nullptr);
+    EXPECT_EQ(err[YmErrCode_TypeNotFound], 1);
+}
+
 TEST(Loading, Fail_ConcreteType_ArgPackOnConcreteType) {
     SETUP_ALL(ctx);
     SETUP_PARCELDEF(p_def);
@@ -1345,6 +1496,42 @@ TEST(Loading, Fail_TypeArgsError_ArgDoesntConformToConstraint_FnLikeCallableType
     EXPECT_EQ(err[YmErrCode_TypeArgsError], 1);
 }
 
+TEST(Loading, Fail_TypeArgsError_ArgDoesntConformToConstraint_ManyTypeArgs) {
+    // NOTE: Enough types are loaded here that constraint checking is split up across worker threads,
+    //       w/ an error still having to be raised for each non-conforming type arg.
+    // Generics:
+    //      T[X: P]
+    // 
+    // Dep Graph:
+    //      p:Root      -> p:T[p:A0], p:T[p:A1], ..., p:T[p:A99]
+    // 
+    //      p:T[p:Ai]   -> p:Ai     (X == p:Ai; p:Ai doesn't conform to p:P if i % 10 == 0.)
+    SETUP_ALL(ctx);
+    SETUP_PARCELDEF(p_def);
+
+    setup_struct(p_def, "Int", {});
+
+    setup_protocol(p_def, "P", {});
+    ymParcelDef_AddMethodReq(p_def, "P", "m", "p:Int");
+
+    setup_struct(p_def, "T", {}, { { "X", "p:P" } });
+
+    setup_struct(p_def, "Root", {});
+    for (size_t i = 0; i < 100; i++) {
+        const auto name = std::format("A{}", i);
+        setup_struct(p_def, name, {});
+        if (i % 10 != 0) {
+            setup_method(p_def, name, "m", "p:Int", {});
+        }
+        ymParcelDef_AddRef(p_def, "Root", std::format("p:T[p:{}]", name).c_str());
+    }
+
+    ymDm_BindParcelDef(dm, "p", p_def);
+
+    EXPECT_EQ(ymCtx_Load(ctx, "p:Root"), nullptr);
+    EXPECT_EQ(err[YmErrCode_TypeArgsError], 10);
+}
+
 TEST(Loading, Fail_TypeArgsError_TooManyArgs) {
     SETUP_ALL(ctx);
     SETUP_PARCELDEF(p_def);
@@ -131,6 +131,19 @@ TEST(Redirects, SubjectPrefixPathsSegregateRedirects) {
 	EXPECT_EQ(ymType_ReturnType(p_b_f), q_b_A);
 }
 
+TEST(Redirects, SubjectPrefixPathsMatchOnlyWholePathSegments) {
+	SETUP_ALL(ctx);
+	SETUP_PARCELDEF(pq_def);
+	ymParcelDef_AddFn(pq_def, "f", "alt:A", ymInertCallBhvrFn, nullptr);
+	SETUP_PARCELDEF(q_def);
+	ymParcelDef_AddStruct(q_def, "A");
+	ymDm_BindParcelDef(dm, "pq", pq_def);
+	ymDm_BindParcelDef(dm, "q", q_def);
+	ASSERT_TRUE(ymDm_AddRedirect(dm, "p", "alt", "q"));
+	EXPECT_FALSE(ymCtx_Load(ctx, "pq:f")); // 'p' isn't a path prefix of 'pq'.
+	EXPECT_EQ(err[YmErrCode_ParcelNotFound], 1);
+}
+
 TEST(Redirects, BeforePrefixPathsCoverAllPathsContainingThem) {
 	SETUP_ALL(ctx);
 	SETUP_PARCELDEF(p_def);
@@ -190,6 +203,23 @@ TEST(Redirects, BeforePrefixPathsShadowRedirectsWithLessSpecificOnes) {
 	EXPECT_EQ(ymType_ParamType(f, 1), q_c_A);
 }
 
+TEST(Redirects, BeforePrefixPathsMatchOnlyWholePathSegments) {
+	SETUP_ALL(ctx);
+	SETUP_PARCELDEF(p_def);
+	ymParcelDef_AddFn(p_def, "f", "altq:A", ymInertCallBhvrFn, nullptr);
+	SETUP_PARCELDEF(q_def);
+	ymParcelDef_AddStruct(q_def, "A");
+	SETUP_PARCELDEF(altq_def);
+	ymParcelDef_AddStruct(altq_def, "A");
+	ymDm_BindParcelDef(dm, "p", p_def);
+	ymDm_BindParcelDef(dm, "q", q_def);
+	ymDm_BindParcelDef(dm, "altq", altq_def);
+	ASSERT_TRUE(ymDm_AddRedirect(dm, "p", "alt", "q"));
+	YmType* f = load(ctx, "p:f");
+	YmType* altq_A = load(ctx, "altq:A");
+	EXPECT_EQ(ymType_ReturnType(f), altq_A); // 'alt' isn't a path prefix of 'altq'.
+}
+
 TEST(Redirects, WorksInTypeArgsAndCallSuffParamAndReturnTypes) {
 	SETUP_ALL(ctx);
 	SETUP_PARCELDEF(p_def);
@@ -57,6 +57,21 @@ namespace _ym {
 				discard();
 			}
 		}
+
+		// Like commitOrDiscard, but committing only types reachable from root, discarding types
+		// which were only needed during loading (ie. for constraint checking.)
+		// Parcels are committed regardless.
+		// Pruning occurs before locking lockIfCommit, so it doesn't block readers.
+		inline void commitReachableOrDiscard(const YmType* root, ym::Lockable auto& lockIfCommit) {
+			if (root) {
+				types.prune(*root);
+				std::scoped_lock lk(lockIfCommit);
+				this->commit();
+			}
+			else {
+				discard();
+			}
+		}
 	};
 }
 
@@ -162,6 +162,13 @@ namespace _ym {
                 : std::nullopt;
         }
 
+        // Appends x w/out checking if it's already present, returning its index.
+        // This is for rebuilding tables already known to be free of duplicates (ie. from images.)
+        inline ConstIndex push(ConstInfo x) {
+            _consts.push_back(std::move(x));
+            return _consts.size() - 1;
+        }
+
 
     private:
         std::vector<ConstInfo> _consts;
@@ -0,0 +1,30 @@
+#include "CtxStats.h"
+
+#include <algorithm>
+
+
+void _ym::CtxStats::get(YmUInt64* out) const noexcept {
+    ymAssert(out != nullptr);
+#if defined(YM_CTX_STATS)
+    std::copy(_stats.begin(), _stats.end(), out);
+#else
+    std::fill_n(out, size_t(YmCtxStat_Num), YmUInt64(0));
+#endif
+}
+
+void _ym::CtxStats::getConversions(YmUInt64* out) const noexcept {
+    ymAssert(out != nullptr);
+#if defined(YM_CTX_STATS)
+    std::copy(_conversions.begin(), _conversions.end(), out);
+#else
+    std::fill_n(out, size_t(YmPrimitiveKind_Num) * YmPrimitiveKind_Num, YmUInt64(0));
+#endif
+}
+
+void _ym::CtxStats::reset() noexcept {
+#if defined(YM_CTX_STATS)
+    _stats = {};
+    _conversions = {};
+#endif
+}
+
@@ -0,0 +1,73 @@
+
+
+#pragma once
+
+
+#include <array>
+#include <optional>
+
+#include "../yama/yama.h"
+
+
+namespace _ym {
+
+
+    // Runtime statistics of a context (see YmCtxStat), gathered only if YM_CTX_STATS is defined,
+    // w/ the code gathering them otherwise being compiled out (see YM_CTX_STAT, etc. below.)
+    //
+    // Contexts are only ever used by one thread at a time, so unlike load stats, these needn't be
+    // atomic, keeping them cheap enough to always gather.
+    class CtxStats final {
+    public:
+        CtxStats() = default;
+
+
+        // Writes stats to out, indexed by YmCtxStat (w/ stats being 0 if not gathered.)
+        void get(YmUInt64* out) const noexcept;
+        // Writes conversion counts to out, indexed [from * YmPrimitiveKind_Num + to] (w/ counts
+        // being 0 if not gathered.)
+        void getConversions(YmUInt64* out) const noexcept;
+        void reset() noexcept;
+
+
+#if defined(YM_CTX_STATS)
+        inline void record(YmCtxStat stat, YmUInt64 n = 1) noexcept {
+            _stats[size_t(stat)] += n;
+        }
+        // Records x to stat if it exceeds its current value.
+        inline void peak(YmCtxStat stat, YmUInt64 x) noexcept {
+            auto& current = _stats[size_t(stat)];
+            if (x > current) {
+                current = x;
+            }
+        }
+        // Records a conversion from -> to, if both are primitive kinds.
+        inline void conversion(std::optional<YmPrimitiveKind> from, std::optional<YmPrimitiveKind> to) noexcept {
+            if (from && to) {
+                _conversions[size_t(*from) * YmPrimitiveKind_Num + size_t(*to)]++;
+            }
+        }
+
+
+    private:
+        std::array<YmUInt64, YmCtxStat_Num> _stats = {};
+        std::array<YmUInt64, YmPrimitiveKind_Num * YmPrimitiveKind_Num> _conversions = {};
+#endif
+    };
+}
+
+
+#if defined(YM_CTX_STATS)
+// Records n to context stat YmCtxStat_[stat] of stats.
+#define YM_CTX_STAT(stats, stat, n) (stats).record(YmCtxStat_##stat, (n))
+// Records x to context stat YmCtxStat_[stat] of stats if it exceeds its current value.
+#define YM_CTX_STAT_PEAK(stats, stat, x) (stats).peak(YmCtxStat_##stat, (x))
+// Records a conversion between primitive kinds from and to (of type std::optional<YmPrimitiveKind>)
+// to stats, w/ from and to not being evaluated if context stats aren't gathered.
+#define YM_CTX_STAT_CONVERSION(stats, from, to) (stats).conversion((from), (to))
+#else
+#define YM_CTX_STAT(stats, stat, n) ((void)0)
+#define YM_CTX_STAT_PEAK(stats, stat, x) ((void)0)
+#define YM_CTX_STAT_CONVERSION(stats, from, to) ((void)0)
+#endif
+
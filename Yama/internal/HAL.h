@@ -71,6 +71,11 @@ namespace _ym {
             return object.size();
         }
 
+        // Returns the size (in bytes) of the memory block of a HAL data structure w/ an array of size s.
+        inline static constexpr size_t bytes(size_t s) noexcept {
+            return sizeof(Unit) * (unitsPerHeader + unitsPerElement * s);
+        }
+
         inline static Element* elementPtr(Header& object, size_t index) noexcept {
             return (Element*)(((Unit*)&object) + unitsPerHeader + unitsPerElement * index);
         }
@@ -90,7 +95,9 @@ namespace _ym {
         inline static Header* create(Header&& header, Alloc& al) {
             auto s = size(header);
             Header* result = (Header*)AllocTraits::template rebind_alloc<Unit>(al).allocate(unitsPerHeader + unitsPerElement * s);
-            ymAssert(result != nullptr);
+            if (!result) {
+                return nullptr; // Allocator failed (for allocators which don't throw.)
+            }
             std::construct_at(result, std::forward<Header>(header));
             for (size_t i = 0; i < s; i++) {
                 std::construct_at(elementPtr(*result, i));
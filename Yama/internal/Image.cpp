@@ -0,0 +1,144 @@
+#include "Image.h"
+
+#include <bit>
+#include <fstream>
+#include <iterator>
+
+
+namespace {
+    constexpr std::string_view magic = "YMIMAGE";
+    // Incr this whenever the layout of images changes.
+    constexpr YmUInt32 version = 2;
+}
+
+
+_ym::ImageWriter::ImageWriter(ImageKind k) {
+    _data.append(magic);
+    u32(version);
+    u8(YmUInt8(k));
+}
+
+const std::string& _ym::ImageWriter::data() const noexcept {
+    return _data;
+}
+
+void _ym::ImageWriter::u8(YmUInt8 x) {
+    _data.push_back(char(x));
+}
+
+void _ym::ImageWriter::u16(YmUInt16 x) {
+    u8(YmUInt8(x));
+    u8(YmUInt8(x >> 8));
+}
+
+void _ym::ImageWriter::u32(YmUInt32 x) {
+    u16(YmUInt16(x));
+    u16(YmUInt16(x >> 16));
+}
+
+void _ym::ImageWriter::u64(YmUInt64 x) {
+    u32(YmUInt32(x));
+    u32(YmUInt32(x >> 32));
+}
+
+void _ym::ImageWriter::i64(YmInt64 x) {
+    u64(YmUInt64(x));
+}
+
+void _ym::ImageWriter::f64(YmFloat64 x) {
+    u64(std::bit_cast<YmUInt64>(x));
+}
+
+void _ym::ImageWriter::str(std::string_view x) {
+    u32(YmUInt32(x.size()));
+    _data.append(x);
+}
+
+_ym::ImageReader::ImageReader(std::string_view data) :
+    _data(data) {
+}
+
+bool _ym::ImageReader::header(ImageKind k) {
+    if (_data.substr(0, magic.size()) != magic) {
+        return false;
+    }
+    _pos = magic.size();
+    const auto v = u32();
+    const auto k0 = u8();
+    return good() && v == version && k0 == YmUInt8(k);
+}
+
+bool _ym::ImageReader::good() const noexcept {
+    return _good;
+}
+
+bool _ym::ImageReader::done() const noexcept {
+    return _pos == _data.size();
+}
+
+YmUInt8 _ym::ImageReader::u8() {
+    return YmUInt8(_uint(1));
+}
+
+YmUInt16 _ym::ImageReader::u16() {
+    return YmUInt16(_uint(2));
+}
+
+YmUInt32 _ym::ImageReader::u32() {
+    return YmUInt32(_uint(4));
+}
+
+YmUInt64 _ym::ImageReader::u64() {
+    return _uint(8);
+}
+
+YmInt64 _ym::ImageReader::i64() {
+    return YmInt64(u64());
+}
+
+YmFloat64 _ym::ImageReader::f64() {
+    return std::bit_cast<YmFloat64>(u64());
+}
+
+std::string_view _ym::ImageReader::str() {
+    const size_t n = u32();
+    if (!_good || _data.size() - _pos < n) {
+        _good = false;
+        return {};
+    }
+    auto result = _data.substr(_pos, n);
+    _pos += n;
+    return result;
+}
+
+YmUInt64 _ym::ImageReader::_uint(size_t bytes) {
+    if (!_good || _data.size() - _pos < bytes) {
+        _good = false;
+        return 0;
+    }
+    YmUInt64 result = 0;
+    for (size_t i = 0; i < bytes; i++) {
+        result |= YmUInt64(YmUInt8(_data[_pos + i])) << (i * 8);
+    }
+    _pos += bytes;
+    return result;
+}
+
+bool _ym::writeImageFile(const std::string& path, const std::string& data) {
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    f.write(data.data(), std::streamsize(data.size()));
+    return bool(f);
+}
+
+std::optional<std::string> _ym::readImageFile(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) {
+        return std::nullopt;
+    }
+    std::string result(std::istreambuf_iterator<char>(f), {});
+    return
+        !f.bad()
+        ? std::make_optional(std::move(result))
+        : std::nullopt;
+}
+
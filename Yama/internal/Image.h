@@ -0,0 +1,92 @@
+
+
+#pragma once
+
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "../yama/yama.h"
+
+
+namespace _ym {
+
+
+    // What an image encodes, written to its header so images of one kind can't be mistaken
+    // for those of another.
+    enum class ImageKind : YmUInt8 {
+        Dm = 0,     // See ymDm_SaveImage.
+        ParcelDef,  // See ymParcelDef_Serialize.
+
+        Num, // Enum size. Not an image kind.
+    };
+
+
+    // Writes binary images.
+    // Scalars are written little-endian, so images are portable across hosts.
+    class ImageWriter final {
+    public:
+        // Writes the header of an image of kind k.
+        explicit ImageWriter(ImageKind k);
+
+
+        const std::string& data() const noexcept;
+
+        void u8(YmUInt8 x);
+        void u16(YmUInt16 x);
+        void u32(YmUInt32 x);
+        void u64(YmUInt64 x);
+        void i64(YmInt64 x);
+        void f64(YmFloat64 x);
+        // Writes x prefixed by its length.
+        void str(std::string_view x);
+
+
+    private:
+        std::string _data;
+    };
+
+    // Reads binary images written by ImageWriter.
+    // Reads past the end of the image (ie. if it's truncated or malformed) yield 0 or empty
+    // strings, and cause the reader to go bad, so callers can read a whole record before
+    // checking good.
+    class ImageReader final {
+    public:
+        // data must outlive the reader.
+        explicit ImageReader(std::string_view data);
+
+
+        // Returns if the header of the image is valid, and of kind k.
+        bool header(ImageKind k);
+
+        bool good() const noexcept;
+        // Returns if all of the image has been read.
+        bool done() const noexcept;
+
+        YmUInt8 u8();
+        YmUInt16 u16();
+        YmUInt32 u32();
+        YmUInt64 u64();
+        YmInt64 i64();
+        YmFloat64 f64();
+        // The returned string views data.
+        std::string_view str();
+
+
+    private:
+        std::string_view _data;
+        size_t _pos = 0;
+        bool _good = true;
+
+
+        YmUInt64 _uint(size_t bytes);
+    };
+
+
+    // Writes data to the file at path, returning if successful.
+    bool writeImageFile(const std::string& path, const std::string& data);
+    // Reads the whole file at path, returning std::nullopt if unsuccessful.
+    std::optional<std::string> readImageFile(const std::string& path);
+}
+
@@ -0,0 +1,112 @@
+#include "InternPool.h"
+
+#include <mutex>
+#include <utility>
+
+
+
+_ym::InternPool& _ym::InternPool::global() noexcept {
+	static InternPool* const pool = new InternPool();
+	return *pool;
+}
+
+size_t _ym::InternPool::count() const noexcept {
+	std::shared_lock lk(_lock);
+	return _entries.size();
+}
+
+_ym::InternPool::Entry& _ym::InternPool::acquire(std::string_view s) {
+	const size_t hash = taul::hash(s);
+	{
+		// Fast path for strings already interned.
+		std::shared_lock lk(_lock);
+		if (const auto it = _entries.find(s); it != _entries.end() && _tryAddRef(*it->second)) {
+			return *it->second;
+		}
+	}
+	std::scoped_lock lk(_lock);
+	if (const auto it = _entries.find(s); it != _entries.end()) {
+		if (_tryAddRef(*it->second)) {
+			return *it->second;
+		}
+		// Entry is dying, so replace it (its releaser will delete it.)
+		_entries.erase(it);
+	}
+	auto entry = new Entry(hash, std::string(s));
+	_entries.try_emplace(std::string_view(entry->str), entry);
+	return *entry;
+}
+
+void _ym::InternPool::release(Entry& entry) noexcept {
+	if (entry.refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+		return;
+	}
+	// Entries w/ ref count 0 cannot be revived (see _tryAddRef), so we're the only one able to delete entry.
+	{
+		std::scoped_lock lk(_lock);
+		if (const auto it = _entries.find(std::string_view(entry.str)); it != _entries.end() && it->second == &entry) {
+			_entries.erase(it);
+		}
+	}
+	delete &entry;
+}
+
+bool _ym::InternPool::_tryAddRef(Entry& entry) noexcept {
+	size_t old = entry.refs.load(std::memory_order_relaxed);
+	do {
+		if (old == 0) {
+			return false;
+		}
+	} while (!entry.refs.compare_exchange_weak(old, old + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+	return true;
+}
+
+_ym::IStr::IStr() :
+	IStr(std::string_view()) {
+}
+
+_ym::IStr::IStr(std::string_view s) :
+	_entry(&InternPool::global().acquire(s)) {
+}
+
+_ym::IStr::IStr(const std::string& s) :
+	IStr(std::string_view(s)) {
+}
+
+_ym::IStr::IStr(const char* s) :
+	IStr(std::string_view(s)) {
+}
+
+_ym::IStr::IStr(const IStr& other) noexcept :
+	_entry(other._entry) {
+	_entry->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+_ym::IStr::IStr(IStr&& other) noexcept :
+	IStr(std::as_const(other)) {
+	// NOTE: Moving is copying as moved-from handles must remain valid.
+}
+
+_ym::IStr::~IStr() noexcept {
+	InternPool::global().release(*_entry);
+}
+
+_ym::IStr& _ym::IStr::operator=(const IStr& rhs) noexcept {
+	if (_entry != rhs._entry) {
+		rhs._entry->refs.fetch_add(1, std::memory_order_relaxed);
+		InternPool::global().release(*_entry);
+		_entry = rhs._entry;
+	}
+	return *this;
+}
+
+_ym::IStr& _ym::IStr::operator=(IStr&& rhs) noexcept {
+	return *this = std::as_const(rhs);
+}
+
+std::strong_ordering _ym::IStr::operator<=>(const IStr& other) const noexcept {
+	return
+		_entry == other._entry
+		? std::strong_ordering::equal
+		: string() <=> other.string();
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+
+#include <atomic>
+#include <compare>
+#include <concepts>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <taul/hashing.h>
+
+#include "../yama++/macros.h"
+
+
+namespace _ym {
+
+
+	// Thread-safe pool of interned strings.
+	// Entries are ref counted by the IStr handles referencing them, w/ entries being
+	// removed from the pool when their last handle is destroyed.
+	// Interning is process-wide (rather than per-domain) as strings (ie. specifiers and names)
+	// are routinely created w/out a domain being available, and so that domains share strings.
+	class InternPool final {
+	public:
+		struct Entry final {
+			std::atomic<size_t> refs;
+			const size_t hash;
+			const std::string str;
+
+
+			inline Entry(size_t hash, std::string str) :
+				refs(1),
+				hash(hash),
+				str(std::move(str)) {
+			}
+		};
+
+
+		InternPool() = default;
+		InternPool(const InternPool&) = delete;
+		InternPool(InternPool&&) = delete;
+		InternPool& operator=(const InternPool&) = delete;
+		InternPool& operator=(InternPool&&) = delete;
+
+		// The global pool is immortal, so handles w/ static storage duration are safe to use.
+		static InternPool& global() noexcept;
+
+
+		// Returns the number of strings interned.
+		size_t count() const noexcept;
+
+		// Returns entry for s, creating it if needed, w/ the ref count of the entry being incremented.
+		Entry& acquire(std::string_view s);
+
+		// Decrements the ref count of entry, removing it from the pool if it reaches 0.
+		void release(Entry& entry) noexcept;
+
+
+	private:
+		struct _Hash final {
+			inline size_t operator()(std::string_view x) const noexcept { return taul::hash(x); }
+		};
+
+
+		mutable std::shared_mutex _lock;
+		std::unordered_map<std::string_view, Entry*, _Hash> _entries; // Keys view into entry strings.
+
+
+		static bool _tryAddRef(Entry& entry) noexcept;
+	};
+
+	// Handle to an interned string.
+	// Handles to equal strings share the same pool entry, w/ equality being pointer equality,
+	// and w/ hashing using the hash precomputed upon interning.
+	class IStr final {
+	public:
+		IStr(); // Empty string.
+		IStr(std::string_view s);
+		IStr(const std::string& s);
+		IStr(const char* s);
+		IStr(const IStr& other) noexcept;
+		IStr(IStr&& other) noexcept;
+		~IStr() noexcept;
+		IStr& operator=(const IStr& rhs) noexcept;
+		IStr& operator=(IStr&& rhs) noexcept;
+
+
+		inline bool operator==(const IStr& other) const noexcept { return _entry == other._entry; }
+		inline bool operator==(const std::convertible_to<std::string_view> auto& other) const noexcept {
+			return string() == std::string_view(other);
+		}
+		std::strong_ordering operator<=>(const IStr& other) const noexcept;
+
+
+		inline const std::string& string() const noexcept { return _entry->str; }
+		inline operator const std::string& () const noexcept { return string(); }
+		inline operator std::string_view () const noexcept { return string(); }
+
+		inline const char* c_str() const noexcept { return string().c_str(); }
+		inline size_t size() const noexcept { return string().size(); }
+		inline bool empty() const noexcept { return string().empty(); }
+
+		inline size_t hash() const noexcept { return _entry->hash; }
+
+
+	private:
+		InternPool::Entry* _entry;
+	};
+}
+
+YM_FORMATTER(_ym::IStr, x.string());
+
+namespace std {
+	template<>
+	struct hash<_ym::IStr> final {
+		using is_transparent = void;
+		size_t operator()(const _ym::IStr& x) const noexcept {
+			return x.hash();
+		}
+		size_t operator()(const std::string& x) const {
+			return taul::hash((std::string_view)x);
+		}
+		size_t operator()(const std::string_view& x) const {
+			return taul::hash(x);
+		}
+		size_t operator()(const char* x) const {
+			return taul::hash((std::string_view)x);
+		}
+	};
+	template<>
+	struct equal_to<_ym::IStr> final {
+		using is_transparent = void;
+		bool operator()(const _ym::IStr& lhs, const _ym::IStr& rhs) const noexcept {
+			return lhs == rhs;
+		}
+		bool operator()(const _ym::IStr& lhs, const std::string& rhs) const {
+			return lhs.string() == rhs;
+		}
+		bool operator()(const _ym::IStr& lhs, const std::string_view& rhs) const {
+			return lhs.string() == rhs;
+		}
+		bool operator()(const _ym::IStr& lhs, const char* rhs) const {
+			return lhs.string() == rhs;
+		}
+		bool operator()(const std::string& lhs, const _ym::IStr& rhs) const {
+			return lhs == rhs.string();
+		}
+		bool operator()(const std::string_view& lhs, const _ym::IStr& rhs) const {
+			return lhs == rhs.string();
+		}
+		bool operator()(const char* lhs, const _ym::IStr& rhs) const {
+			return lhs == rhs.string();
+		}
+	};
+}
@@ -2,6 +2,10 @@
 
 #include "LoadManager.h"
 
+#include <algorithm>
+
+#include "WorkerPool.h"
+
 
 #define _DUMP_LOG 0
 
@@ -10,11 +14,12 @@
 #endif
 
 
-_ym::LoadManager::LoadManager(Area& staging, PathBindings& binds, Redirects& redirects) :
+_ym::LoadManager::LoadManager(Area& staging, PathBindings& binds, Redirects& redirects, MemberMaterializer& materializer) :
     staging(staging),
+    _materializer(materializer),
     _termStk(staging, binds, redirects,
-        [this](YmParcel& p, const TypeInfo& info, std::vector<ym::Safe<YmType>> typeArgs) -> ym::Safe<YmType> {
-            return _genNonMemberTypeData(p, info, std::move(typeArgs));
+        [this](YmParcel& p, const TypeInfo& info, std::span<const ym::Safe<YmType>> typeArgs) -> ym::Safe<YmType> {
+            return _genNonMemberTypeData(p, info, typeArgs);
         }) {
 }
 
@@ -50,12 +55,57 @@ YmType* _ym::LoadManager::load(const Spec& fullname) {
     return result;
 }
 
+YmType* _ym::LoadManager::materializeMember(YmType& owner, YmMemberIndex index) {
+    if (_loading) {
+        auto result = &_materializeMember(owner, index);
+        // If not within a term stack session (ie. if conformance checking), then the caller
+        // expects the member to be usable upon return.
+        if (!_termStk.inSession()) {
+            _processLateResolveQueue();
+            // If late resolve failed, then the import/load as a whole fails.
+            if (!_good()) {
+                result = nullptr;
+            }
+        }
+        return result;
+    }
+#if _DUMP_LOG
+    ym::println("LoadManager: Materializing {} member #{}.", owner.fullname(), index + 1);
+#endif
+    _beginImportOrLoad();
+    auto result = &_materializeMember(owner, index);
+    _processLateResolveQueue();
+    _checkRefConstCallSigConformance();
+    // Members are checked upon loading of their owner, and resolve against the parcels committed
+    // then (rather than current bindings), so this shouldn't fail, but if it does, then fail
+    // like any other load (w/ errors raised), rather than publish a member w/ unresolved consts.
+    if (!_good()) {
+        result = nullptr;
+    }
+    _endImportOrLoad();
+    return result;
+}
+
+void _ym::LoadManager::flushMaterialized(bool publish) noexcept {
+    if (publish) {
+        for (const auto& [owner, index, member] : _materialized) {
+            if (staging->types.existsById(member->getId())) {
+                owner->publishMember(index, *member);
+            }
+        }
+    }
+    _materialized.clear();
+}
+
 void _ym::LoadManager::_beginImportOrLoad() {
     _clearFlag();
+    _loading = true;
 }
 
 void _ym::LoadManager::_endImportOrLoad() {
     _flushLateResolveQueue();
+    _memberCallSuffChecks.clear();
+    _loading = false;
 }
 
 bool _ym::LoadManager::_good() const noexcept {
@@ -73,31 +123,41 @@ void _ym::LoadManager::_clearFlag() noexcept {
 _ym::LoadManager::_GenTypeDataResult _ym::LoadManager::_genTypeData(
     ym::Safe<YmParcel> parcel,
     ym::Safe<const _ym::TypeInfo> info,
-    YmType* owner,
-    std::vector<ym::Safe<YmType>> typeArgs) {
+    const YmType* owner,
+    std::span<const ym::Safe<YmType>> typeArgs) {
     ymAssert(!owner || typeArgs.empty());
     ymAssert(bool(owner) != info->isOwner());
-    // Generate our new type data.
-    auto newType =
+    // Lookup if an type w/ same id is already loaded, aborting upload if found,
+    // quietly returning it instead.
+    // Doing this via type id avoids needing to generate the new type's fullname
+    // just to discover that it's a duplicate.
+    const YmType::Id id =
         !owner
-        ? std::make_shared<YmType>(parcel, info, std::move(typeArgs))
-        : std::make_shared<YmType>(parcel, info, *owner);
-    // Lookup if an type w/ same fullname is already loaded, aborting upload if
-    // found, quietly returning it instead.
-    if (auto existing = staging->types.fetch(newType->fullname())) {
+        ? YmType::Id(*parcel, *info, typeArgs)
+        : YmType::Id(*parcel, *info, *owner);
+    if (auto existing = staging->types.fetchById(id)) {
         return _GenTypeDataResult{
             .type = *existing,
             .original = false,
         };
     }
+    // Generate our new type data.
+    auto newType =
+        !owner
+        ? std::make_shared<YmType>(parcel, info, std::vector(typeArgs.begin(), typeArgs.end()), _materializer.get())
+        : std::make_shared<YmType>(parcel, info, *owner);
+    ymAssert(newType->getId() == id);
 #if _DUMP_LOG
     ym::println("LoadManager: Generating {} type data.", newType->fullname());
 #endif
     // Push before resolving consts to ensure that the loading resource is available
     // for lookup for resolving the consts of other types.
-    if (!staging->types.push(newType)) {
+    // Members are pushed nameless so their fullnames needn't be generated, w/ them instead being
+    // reached via their owners (or by type id.)
+    if (!staging->types.push(newType, newType->isMember())) {
         YM_DEADEND;
     }
+    YM_LOAD_STAT(TypesGenerated, 1);
     return _GenTypeDataResult{
         .type = *newType,
         .original = true,
@@ -107,36 +167,46 @@ _ym::LoadManager::_GenTypeDataResult _ym::LoadManager::_genTypeData(
 ym::Safe<YmType> _ym::LoadManager::_genNonMemberTypeData(
     ym::Safe<YmParcel> parcel,
     ym::Safe<const _ym::TypeInfo> info,
-    std::vector<ym::Safe<YmType>> typeArgs) {
+    std::span<const ym::Safe<YmType>> typeArgs) {
     ymAssert(info->isOwner());
-    auto newType = _genTypeData(parcel, info, nullptr, std::move(typeArgs));
+    auto newType = _genTypeData(parcel, info, nullptr, typeArgs);
     if (newType.original) {
         _scheduleLateResolve(*newType.type);
-        _genTypeDataForMembers(parcel, info, newType.type);
         _earlyResolveType(*newType.type, newType.type);
-        _earlyResolveMembers(*newType.type, newType.type);
     }
     return newType.type;
 }
 
-void _ym::LoadManager::_genTypeDataForMembers(
+_ym::LoadManager::_GenTypeDataResult _ym::LoadManager::_genMemberTypeData(
     ym::Safe<YmParcel> parcel,
     ym::Safe<const _ym::TypeInfo> info,
     ym::Safe<YmType> self) {
-    ymAssert(info->isOwner());
-    for (YmMembers i = 0; i < info->members(); i++) {
-        _genMemberTypeData(parcel, ym::Safe(_lookupMemberInfo(parcel, *info, info->member(i)->name)), self);
+    ymAssert(!info->isOwner());
+    auto newType = _genTypeData(parcel, info, self);
+    if (newType.original) {
+        _scheduleLateResolve(*newType.type);
+        _earlyResolveType(*newType.type, self);
     }
+    return newType;
 }
 
-void _ym::LoadManager::_genMemberTypeData(
-    ym::Safe<YmParcel> parcel,
-    ym::Safe<const _ym::TypeInfo> info,
-    ym::Safe<YmType> self) {
-    ymAssert(!info->isOwner());
-    if (auto newType = _genTypeData(parcel, info, self); newType.original) {
-        _scheduleLateResolve(*newType.type);
+YmType& _ym::LoadManager::_materializeMember(YmType& owner, YmMemberIndex index) {
+    if (const auto result = owner.tryMemberType(index)) {
+        return *result;
+    }
+    const auto& memberInfo = ym::deref(_lookupMemberInfo(owner.parcel, *owner.info, owner.info->member(index)->name));
+    // If not original, then member was already materialized earlier in this import/load.
+    auto member = _genMemberTypeData(owner.parcel, memberInfo, owner);
+    // Checks performed across worker threads must only ever fetch members materialized beforehand.
+    ymAssert(!member.original || !_checkingInParallel);
+    if (member.original) {
+        _materialized.push_back(_Materialized{
+            .owner = owner.shared_from_this(),
+            .index = index,
+            .member = member.type->shared_from_this(),
+            });
     }
+    return *member.type;
 }
 
 const _ym::TypeInfo* _ym::LoadManager::_lookupMemberInfo(
@@ -161,14 +231,20 @@ bool _ym::LoadManager::_isEarlyResolveConst(const ConstInfo& constInfo) const {
         : std::regex_match(constInfo.as<RefInfo>().sym.string(), earlyResolvedRefSymPattern);
 }
 
-void _ym::LoadManager::_earlyResolveMembers(YmType& x, ym::Safe<YmType> self) {
-#if _DUMP_LOG
-    ym::println("LoadManager: Early resolving {} members.", x.fullname());
-#endif
-    ymAssert(!x.owner());
-    for (YmMemberIndex i = 0; i < x.members(); i++) {
-        _earlyResolveType(x.member(i)->type(), self);
+bool _ym::LoadManager::_isLazyMemberConst(const YmType& x, ConstIndex index) const {
+    if (!x.isOwner()) {
+        return false;
+    }
+    // Refs and type param constraints are accessed via the const table, so can't be lazy.
+    if (std::ranges::find(x.info->refs, index) != x.info->refs.end()) {
+        return false;
+    }
+    for (YmTypeParamIndex i = 0; i < x.info->typeParams(); i++) {
+        if (x.info->typeParam(i)->constraintConst == index) {
+            return false;
+        }
     }
+    return true;
 }
 
 void _ym::LoadManager::_earlyResolveType(YmType& x, ym::Safe<YmType> self) {
@@ -185,6 +261,7 @@ void _ym::LoadManager::_earlyResolveConsts(YmType& x, ym::Safe<YmType> self) {
 #if _DUMP_LOG
             ym::println("LoadManager: Resolving {} (const #{}).", fmt(consts[i]), i + 1);
 #endif
+            YM_LOAD_STAT(EarlyResolutions, 1);
             if (consts.isVal(i)) {
                 x.putValConst(i);
             }
@@ -192,17 +269,19 @@ void _ym::LoadManager::_earlyResolveConsts(YmType& x, ym::Safe<YmType> self) {
                 x.putRefConst(i, self);
             }
             else {
-                // NOTE: Important we use 'self->fullname()' here.
-                auto ownerName = self->fullname();
-                auto memberName = std::format("{}::{}", ownerName, consts[i].as<RefInfo>().sym.string().substr(strlen("$Self::")));
-                if (auto memberType = staging->types.fetch(Spec::typeFast(memberName))) {
-                    x.putRefConst(i, memberType.get());
+                // NOTE: Important we use 'self' here.
+                auto memberName = consts[i].as<RefInfo>().sym.string().substr(strlen("$Self::"));
+                if (auto memberInfo = self->info->member(memberName)) {
+                    // Owner's member type consts are usually left for YmType::memberType to handle.
+                    if (!_isLazyMemberConst(x, i)) {
+                        x.putRefConst(i, &_materializeMember(*self, memberInfo->index));
+                    }
                 }
                 else {
                     _err(
                         YmErrCode_TypeNotFound,
                         "{} has no member \"{}\"!",
-                        ownerName,
+                        self->fullname(),
                         memberName);
                 }
             }
@@ -224,6 +303,7 @@ void _ym::LoadManager::_processLateResolveQueue() {
 #if _DUMP_LOG
     ym::println("LoadManager: Processing late resolve queue.");
 #endif
+    YM_LOAD_STATS_TIMER(LateResolveTime);
     // Stop processing once queue empties, or an error arises.
     while (!_lateResolveQueue.empty() && _good()) {
         _lateResolveType(*_lateResolveQueue.front());
@@ -236,6 +316,9 @@ void _ym::LoadManager::_lateResolveType(YmType& x) {
     ym::println("LoadManager: Late resolving {} consts.", x.fullname());
 #endif
     _lateResolveConsts(x);
+    if (x.isOwner()) {
+        _checkMembers(x);
+    }
     x.buildRefs();
 }
 
@@ -253,15 +336,16 @@ void _ym::LoadManager::_lateResolveRefConst(YmType& x, ConstIndex index) {
 #if _DUMP_LOG
     ym::println("LoadManager: Resolving {} (const #{}).", fmt(constInfo), index + 1);
 #endif
+    YM_LOAD_STAT(LateResolutions, 1);
     // Filter the ref sym such that redirections are handled.
-    auto refSymAfterRedirects = constInfo.as<RefInfo>().sym.transformed(&x.parcel->redirects.value());
+    auto refSymAfterRedirects = constInfo.as<RefInfo>().sym.transformed(x.parcel->redirects.get());
 #if _DUMP_LOG
     ym::println("LoadManager: Redirecting {} -> {}.", constInfo.as<RefInfo>().sym, refSymAfterRedirects);
 #endif
     _termStk.beginSession(
         // TODO: I'm really not 100% what we should provide end-user for diagnostic w/ regards to things
         //       like whether we should provide redirected ref sym, or original unredirected symbol?
-        std::format("{} dependency {}", x.fullname(), refSymAfterRedirects),
+        refSymAfterRedirects,
         x,
         x.path(),
         *x.self());
@@ -276,6 +360,59 @@ void _ym::LoadManager::_lateResolveRefConst(YmType& x, ConstIndex index) {
     _termStk.endSession();
 }
 
+void _ym::LoadManager::_checkMembers(YmType& x) {
+#if _DUMP_LOG
+    ym::println("LoadManager: Checking {} members.", x.fullname());
+#endif
+    // Stop upon error, like _processLateResolveQueue does.
+    for (YmMemberIndex i = 0; i < x.members() && _good(); i++) {
+        const auto& memberInfo = ym::deref(_lookupMemberInfo(x.parcel, *x.info, x.info->member(i)->name));
+        // Skip if already materialized, as then it gets late resolved like any other type.
+        if (staging->types.existsById(YmType::Id(*x.parcel, memberInfo, x))) {
+            continue;
+        }
+        const auto& consts = memberInfo.consts;
+        for (ConstIndex j = 0; j < consts.size(); j++) {
+            if (consts.isVal(j)) {
+                continue;
+            }
+            const auto& refSym = consts[j].as<RefInfo>().sym;
+            if (_isEarlyResolveConst(consts[j])) {
+                // Check '$Self::[MEMBER]' refers to an actual member.
+                if (refSym == "$Self") {
+                    continue;
+                }
+                auto memberName = refSym.string().substr(strlen("$Self::"));
+                if (!x.info->member(memberName)) {
+                    _err(
+                        YmErrCode_TypeNotFound,
+                        "{} has no member \"{}\"!",
+                        x.fullname(),
+                        memberName);
+                }
+                continue;
+            }
+            // Members share their owner's %here, $Self and type params, so resolve w/ x in their place.
+            auto refSymAfterRedirects = refSym.transformed(x.parcel->redirects.get());
+            _termStk.beginSession(refSymAfterRedirects, x, x.path(), x);
+            _termStk.fullname(refSymAfterRedirects.removeCallSuff());
+            auto result = _termStk.expectConcrete();
+            _termStk.endSession();
+            if (!result) {
+                _fail();
+                continue;
+            }
+            x.addMemberDep(*result);
+            if (refSymAfterRedirects.callsuff()) {
+                _memberCallSuffChecks.push_back(_CallSuffCheck{
+                    .type = *result,
+                    .refSym = std::move(refSymAfterRedirects),
+                    });
+            }
+        }
+    }
+}
+
 void _ym::LoadManager::_flushLateResolveQueue() noexcept {
     while (!_lateResolveQueue.empty()) {
         _lateResolveQueue.pop();
@@ -283,6 +420,7 @@ void _ym::LoadManager::_flushLateResolveQueue() noexcept {
 }
 
 YmParcel* _ym::LoadManager::_initialImport(const Spec& path) {
+    YM_LOAD_STATS_TIMER(InterpretTime);
     _termStk.beginSession(path);
     // TODO: Not 100% sure about this, as I'm thinking a more properly solution would be some kind of
     //       setup that calls _termStk.path.
@@ -296,6 +434,7 @@ YmParcel* _ym::LoadManager::_initialImport(const Spec& path) {
 }
 
 YmType* _ym::LoadManager::_initialLoad(const Spec& fullname) {
+    YM_LOAD_STATS_TIMER(InterpretTime);
     _termStk.beginSession(fullname);
     _termStk.fullname(fullname);
     auto result = _termStk.expectConcrete();
@@ -306,6 +445,61 @@ YmType* _ym::LoadManager::_initialLoad(const Spec& fullname) {
     return result;
 }
 
+std::vector<ym::Safe<YmType>> _ym::LoadManager::_stagedTypes() const {
+    std::vector<ym::Safe<YmType>> result{};
+    result.reserve(staging->types.count());
+    for (auto& type : staging->types) {
+        result.push_back(type);
+    }
+    return result;
+}
+
+void _ym::LoadManager::_checkTypes(std::span<const ym::Safe<YmType>> types, const _Check& check) {
+    std::vector<std::vector<_Report>> reports(types.size());
+    if (types.size() < _parallelCheckThreshold) {
+        for (size_t i = 0; i < types.size(); i++) {
+            check(*types[i], reports[i]);
+        }
+    }
+    else {
+#if _DUMP_LOG
+        ym::println("LoadManager: Checking {} types in parallel.", types.size());
+#endif
+#if defined(YM_LOAD_STATS)
+        // So stats recorded by checks on workers get recorded to the stats active on this thread.
+        const auto active = LoadStats::active();
+#endif
+        _checkingInParallel = true;
+        WorkerPool::global().forEach(types.size(), [&](size_t i) {
+            YM_LOAD_STATS_SCOPE(active);
+            check(*types[i], reports[i]);
+            });
+        _checkingInParallel = false;
+    }
+    for (const auto& ofType : reports) {
+        for (const auto& report : ofType) {
+            report();
+        }
+    }
+}
+
+void _ym::LoadManager::_materializeConformanceMembers(std::span<const ym::Safe<YmType>> types) {
+    // Accesses the same member types as YmType::conforms, which stops upon a match not being found.
+    auto materialize = [this](const YmType::Member& pMemb, const std::optional<YmType::Member>& match) -> bool {
+        pMemb.type();
+        if (match) {
+            match->type();
+        }
+        return match && _good();
+        };
+    for (const auto& t : types) {
+        for (YmTypeParamIndex i = 0; i < t->info->typeParams() && _good(); i++) {
+            auto tparam = t->typeParam(i).value();
+            (void)tparam.arg().forEachConformanceMatch(tparam.constraint(), materialize);
+        }
+    }
+}
+
 void _ym::LoadManager::_checkConstraintTypeLegality() {
     if (!_good()) {
         return;
@@ -313,34 +507,39 @@ void _ym::LoadManager::_checkConstraintTypeLegality() {
 #if _DUMP_LOG
     ym::println("LoadManager: Checking constraint type legality.");
 #endif
-    for (auto& type : staging->types) {
+    YM_LOAD_STATS_TIMER(ConstraintCheckTime);
+    _checkTypes(_stagedTypes(), [this](YmType& type, std::vector<_Report>& reports) {
 #if _DUMP_LOG
         ym::println("LoadManager: Checking {} type params.", type.fullname());
 #endif
         for (YmTypeParamIndex i = 0; i < type.info->typeParams(); i++) {
             auto tparam = type.typeParam(i).value();
             if (!tparam.constraint().isProtocol()) {
-                _err(
-                    YmErrCode_NonProtocolType,
-                    "{} type parameter #{} ({}) constraint type {} is not a protocol!",
-                    type.fullname(),
-                    i + 1,
-                    tparam.name(),
-                    tparam.constraint().fullname());
+                reports.push_back([this, &type, i, tparam] {
+                    _err(
+                        YmErrCode_NonProtocolType,
+                        "{} type parameter #{} ({}) constraint type {} is not a protocol!",
+                        type.fullname(),
+                        i + 1,
+                        tparam.name(),
+                        tparam.constraint().fullname());
+                    });
             }
             static const auto immediateTypeParamRefConstraintRefSymPattern = std::regex("^(?!\\$Self)([^\\[:/]+)$");
             const auto& typeParamConstraintRefSym = type.info->consts[tparam.info->constraintConst].as<RefInfo>().sym;
             if (std::regex_match(typeParamConstraintRefSym.string(), immediateTypeParamRefConstraintRefSymPattern)) {
-                _err(
-                    YmErrCode_IllegalConstraint,
-                    "{} type parameter #{} ({}) constraint type symbol {} cannot use type parameter as a constraint type (as the constraining protocol's interface would be indeterminate!)",
-                    type.fullname(),
-                    i + 1,
-                    tparam.name(),
-                    typeParamConstraintRefSym);
+                reports.push_back([this, &type, i, tparam, &typeParamConstraintRefSym] {
+                    _err(
+                        YmErrCode_IllegalConstraint,
+                        "{} type parameter #{} ({}) constraint type symbol {} cannot use type parameter as a constraint type (as the constraining protocol's interface would be indeterminate!)",
+                        type.fullname(),
+                        i + 1,
+                        tparam.name(),
+                        typeParamConstraintRefSym);
+                    });
             }
         }
-    }
+        });
 }
 
 void _ym::LoadManager::_enforceConstraints() {
@@ -350,24 +549,37 @@ void _ym::LoadManager::_enforceConstraints() {
 #if _DUMP_LOG
     ym::println("LoadManager: Enforcing constraints.");
 #endif
-    for (auto& type : staging->types) {
+    YM_LOAD_STATS_TIMER(ConstraintCheckTime);
+    const auto types = _stagedTypes();
+#if defined(YM_LOAD_STATS)
+    for (const auto& t : types) {
+        YM_LOAD_STAT(ConstraintChecks, t->info->typeParams());
+    }
+#endif
+    _materializeConformanceMembers(types);
+    if (!_good()) {
+        return;
+    }
+    _checkTypes(types, [this](YmType& type, std::vector<_Report>& reports) {
 #if _DUMP_LOG
         ym::println("LoadManager: Checking {} type args.", type.fullname());
 #endif
         for (YmTypeParamIndex i = 0; i < type.info->typeParams(); i++) {
             auto tparam = type.typeParam(i).value();
             if (!tparam.arg().conforms(tparam.constraint())) {
-                _err(
-                    YmErrCode_TypeArgsError,
-                    "{} type argument #{} ({}={}) doesn't conform to constraint {}!",
-                    type.fullname(),
-                    i + 1,
-                    tparam.name(),
-                    tparam.arg().fullname(),
-                    tparam.constraint().fullname());
+                reports.push_back([this, &type, i, tparam] {
+                    _err(
+                        YmErrCode_TypeArgsError,
+                        "{} type argument #{} ({}={}) doesn't conform to constraint {}!",
+                        type.fullname(),
+                        i + 1,
+                        tparam.name(),
+                        tparam.arg().fullname(),
+                        tparam.constraint().fullname());
+                    });
             }
         }
-    }
+        });
 }
 
 void _ym::LoadManager::_checkRefConstCallSigConformance() {
@@ -377,7 +589,8 @@ void _ym::LoadManager::_checkRefConstCallSigConformance() {
 #if _DUMP_LOG
     ym::println("LoadManager: Checking ref. const callsig conformance.");
 #endif
-    for (auto& type : staging->types) {
+    YM_LOAD_STATS_TIMER(CallSigCheckTime);
+    _checkTypes(_stagedTypes(), [this](YmType& type, std::vector<_Report>& reports) {
 #if _DUMP_LOG
         ym::println("LoadManager: Checking {} ref consts.", type.fullname());
 #endif
@@ -389,7 +602,7 @@ void _ym::LoadManager::_checkRefConstCallSigConformance() {
                 //       refactor out this recompute.
                 auto& originalRefSym = constInfo->sym;
                 // Filter the ref sym such that redirections are handled.
-                auto refSymAfterRedirects = originalRefSym.transformed(&type.parcel->redirects.value());
+                auto refSymAfterRedirects = originalRefSym.transformed(type.parcel->redirects.get());
 #if _DUMP_LOG
                 ym::println("LoadManager: Redirecting {} -> {}.", originalRefSym, refSymAfterRedirects);
 #endif
@@ -399,16 +612,28 @@ void _ym::LoadManager::_checkRefConstCallSigConformance() {
 #endif
                     auto ref = type.constAsRef(i);
                     if (ref && !ref->checkCallSuff(callsuff)) {
-                        // TODO: Improve this error!
-                        _err(
-                            YmErrCode_TypeNotFound,
-                            "{} does not conform to call suffix {}!",
-                            ref->fullname(),
-                            std::string(*callsuff));
+                        reports.push_back([this, ref, callsuff = std::string(*callsuff)] {
+                            // TODO: Improve this error!
+                            _err(
+                                YmErrCode_TypeNotFound,
+                                "{} does not conform to call suffix {}!",
+                                ref->fullname(),
+                                callsuff);
+                            });
                     }
                 }
             }
         }
+        });
+    for (const auto& [type, refSym] : _memberCallSuffChecks) {
+        if (auto callsuff = refSym.callsuff(); !type->checkCallSuff(callsuff)) {
+            // TODO: Improve this error!
+            _err(
+                YmErrCode_TypeNotFound,
+                "{} does not conform to call suffix {}!",
+                type->fullname(),
+                std::string(*callsuff));
+        }
     }
 }
 
@@ -3,9 +3,13 @@
 #pragma once
 
 
+#include <functional>
 #include <optional>
 #include <queue>
+#include <span>
+#include <vector>
 
+#include "LoadStats.h"
 #include "TermStk.h"
 
 
@@ -20,16 +24,38 @@ namespace _ym {
     //             types/parcels, loading/importing incrementally as a function of stack machine operations.
     //          4) When a stack machine operation loads new type data, the following occur:
     //              a) New type data is generated.
-    //              b) If a non-member, then type data is generated for each of its members.
-    //              c) Performs early resolution of its constant table (this also occurs for members.)
-    //              d) Adds the new type (and its members) to the late resolution queue.
+    //              b) Performs early resolution of its constant table.
+    //              c) Adds the new type to the late resolution queue.
     //          5) Each type in the late resolution queue are processed, performing the following for each:
     //              a) Resolves ref consts that weren't early resolvable.
     //              b) This resolution involves a version of the loading sequence described above, but w/
     //                 additional environment metadata (defining things like %here, $Self, etc.)
     //              c) This resolution may likewise add new types to the late resolution queue, which will
     //                 in turn be processed, w/ this processing occurring until the queue is empty.
+    //              d) If an owner, the ref consts of its members are checked (see below.)
     //          6) Each type newly loaded undergoes constraint checking for each of their type arguments.
+    //
+    //       The per-type checks of step 6 (and the like) are independent of one another, and so for loads
+    //       of many types are split up across WorkerPool::global() (see _checkTypes.)
+    //
+    //       Late resolution is not parallelized, as resolving ref consts involves term stack operations
+    //       which generate type data into staging, w/ resolutions depending upon the types generated by
+    //       earlier ones, and w/ loading stopping at the first resolution to fail.
+
+    // NOTE: Member types are 'materialized' lazily, upon first access via YmType::memberType, as most
+    //       members of most types are never used, w/ materialization following steps 4 and 5 above.
+    //
+    //       Materialization occurring as part of an import/load (ie. via term stack operations, or
+    //       conformance checking) is performed inline, w/ materialized members being published to
+    //       their owners once staging is committed (see flushMaterialized.)
+    //
+    //       Materialization occurring outside an import/load is performed standalone, w/ the loader
+    //       committing staging afterwards.
+    //
+    //       So that loading remains all-or-nothing, the ref consts of members are resolved (but not
+    //       stored) upon loading of their owner, w/ this loading any types members depend upon, and
+    //       ensuring that member materialization cannot fail. The types resolved are recorded as deps
+    //       of the owner, so staging commits don't prune them (see Section::prune.)
 
     // NOTE: Above 'resolution' describes the process of resolving constant table entries for newly
     //       loaded types, w/ for ref consts this entailing their parsing/interpreting.
@@ -61,7 +87,8 @@ namespace _ym {
 		LoadManager(
 			Area& staging,
 			PathBindings& binds,
-			Redirects& redirects);
+			Redirects& redirects,
+			MemberMaterializer& materializer);
 
 
 		// NOTE: Methods exposed for end-user of LoadManager, w/ these handling
@@ -70,11 +97,37 @@ namespace _ym {
 		YmParcel* import(const Spec& path);
 		YmType* load(const Spec& fullname);
 
+		// Materializes member type at index of owner, returning it, or nullptr upon failure.
+		// Members are checked upon loading of their owner, so this shouldn't fail.
+		// Performed inline if called during an import/load, and standalone otherwise.
+		YmType* materializeMember(YmType& owner, YmMemberIndex index);
+		// Publishes (if publish == true) members materialized since the last call to their owners.
+		// Members pruned upon commit are not published.
+		// Call this after staging has been committed/discarded.
+		void flushMaterialized(bool publish) noexcept;
+
 
 	private:
+        // Kept alive via std::shared_ptr, as staging commits may prune member.
+        struct _Materialized final {
+            std::shared_ptr<YmType> owner;
+            YmMemberIndex index;
+            std::shared_ptr<YmType> member;
+        };
+        struct _CallSuffCheck final {
+            ym::Safe<YmType> type;
+            Spec refSym;
+        };
+
+
+		const ym::Safe<MemberMaterializer> _materializer;
 		TermStk _termStk;
 		std::queue<ym::Safe<YmType>> _lateResolveQueue;
+        std::vector<_Materialized> _materialized;
+        std::vector<_CallSuffCheck> _memberCallSuffChecks; // Deferred from _checkMembers.
+        bool _loading = false;
         bool _failFlag = false;
+        bool _checkingInParallel = false; // If _checkTypes is running checks across worker threads.
 
 
         void _beginImportOrLoad();
@@ -101,23 +154,19 @@ namespace _ym {
         _GenTypeDataResult _genTypeData(
             ym::Safe<YmParcel> parcel,
             ym::Safe<const _ym::TypeInfo> info,
-            YmType* owner,
-            std::vector<ym::Safe<YmType>> typeArgs = {});
-        // All type data generation originates from non-members, which in turn generate for members.
+            const YmType* owner,
+            std::span<const ym::Safe<YmType>> typeArgs = {});
         ym::Safe<YmType> _genNonMemberTypeData(
             ym::Safe<YmParcel> parcel,
             ym::Safe<const _ym::TypeInfo> info,
-            std::vector<ym::Safe<YmType>> typeArgs = {});
-        // Call this prior to early resolution so this info is available for it.
-        void _genTypeDataForMembers(
-            ym::Safe<YmParcel> parcel,
-            ym::Safe<const _ym::TypeInfo> info,
-            ym::Safe<YmType> self);
-        // This importantly does NOT invoke early resolution, _genNonMemberTypeData does that.
-        void _genMemberTypeData(
+            std::span<const ym::Safe<YmType>> typeArgs = {});
+        _GenTypeDataResult _genMemberTypeData(
             ym::Safe<YmParcel> parcel,
             ym::Safe<const _ym::TypeInfo> info,
             ym::Safe<YmType> self);
+        // Returns member type at index of owner, generating it if needed, w/out processing the
+        // late resolve queue.
+        YmType& _materializeMember(YmType& owner, YmMemberIndex index);
 
         const _ym::TypeInfo* _lookupMemberInfo(
             ym::Safe<YmParcel> parcel,
@@ -128,7 +177,8 @@ namespace _ym {
             const std::string& memberName);
 
         bool _isEarlyResolveConst(const ConstInfo& constInfo) const;
-        void _earlyResolveMembers(YmType& x, ym::Safe<YmType> self);
+        // Returns if '$Self::[MEMBER]' const at index of owner x can be left unresolved.
+        bool _isLazyMemberConst(const YmType& x, ConstIndex index) const;
         void _earlyResolveType(YmType& x, ym::Safe<YmType> self);
         void _earlyResolveConsts(YmType& x, ym::Safe<YmType> self);
         void _scheduleLateResolve(YmType& x);
@@ -136,12 +186,37 @@ namespace _ym {
         void _lateResolveType(YmType& x);
         void _lateResolveConsts(YmType& x);
         void _lateResolveRefConst(YmType& x, ConstIndex index);
+        // Checks ref consts of the members of owner x, such that their materialization cannot fail.
+        void _checkMembers(YmType& x);
         // Flushes remaining data from late resolve queue (ie. if load exits due to error.)
         void _flushLateResolveQueue() noexcept;
 
         YmParcel* _initialImport(const Spec& path);
         YmType* _initialLoad(const Spec& fullname);
 
+        // Materialization may add types to staging, so iterate over a snapshot.
+        std::vector<ym::Safe<YmType>> _stagedTypes() const;
+
+        // Below this many types, checks aren't worth splitting up across worker threads.
+        static constexpr size_t _parallelCheckThreshold = 64;
+
+        // Raises a deferred error (see _checkTypes.)
+        using _Report = std::function<void()>;
+        using _Check = std::function<void(YmType& type, std::vector<_Report>& reports)>;
+
+        // Performs check for each of types, w/ check deferring the raising of errors by pushing reports
+        // (which call _err) to reports, rather than raising them itself.
+        // Checks are performed across WorkerPool::global() if there are enough types, w/ the reports then
+        // being called on the loading thread (w/ its error callback), in the order of types, such that
+        // errors raised are deterministic, and the same as if checks were performed sequentially.
+        // Checks must not mutate staging, and so must not materialize members (see
+        // _materializeConformanceMembers.)
+        void _checkTypes(std::span<const ym::Safe<YmType>> types, const _Check& check);
+
+        // Materializes the members which checking the conformance of the type args of types to their
+        // constraints accesses, so that this checking may then be performed by _checkTypes.
+        void _materializeConformanceMembers(std::span<const ym::Safe<YmType>> types);
+
         void _checkConstraintTypeLegality();
         void _enforceConstraints();
         void _checkRefConstCallSigConformance();
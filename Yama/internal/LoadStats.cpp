@@ -0,0 +1,69 @@
+#include "LoadStats.h"
+
+#include <algorithm>
+
+
+#if defined(YM_LOAD_STATS)
+namespace {
+    thread_local _ym::LoadStats::Active scopes = {};
+}
+#endif
+
+
+void _ym::LoadStats::get(YmUInt64* out) const noexcept {
+    ymAssert(out != nullptr);
+#if defined(YM_LOAD_STATS)
+    for (size_t i = 0; i < _stats.size(); i++) {
+        out[i] = _stats[i].load(std::memory_order_relaxed);
+    }
+#else
+    std::fill_n(out, size_t(YmLoadStat_Num), YmUInt64(0));
+#endif
+}
+
+void _ym::LoadStats::reset() noexcept {
+#if defined(YM_LOAD_STATS)
+    for (auto& stat : _stats) {
+        stat.store(0, std::memory_order_relaxed);
+    }
+#endif
+}
+
+#if defined(YM_LOAD_STATS)
+void _ym::LoadStats::record(YmLoadStat stat, YmUInt64 n) noexcept {
+    ymAssert(stat < YmLoadStat_Num);
+    for (size_t i = 0; i < scopes.count; i++) {
+        scopes.stats[i]->_stats[size_t(stat)].fetch_add(n, std::memory_order_relaxed);
+    }
+}
+
+_ym::LoadStats::Active _ym::LoadStats::active() noexcept {
+    return scopes;
+}
+
+_ym::LoadStats::Scope::Scope(LoadStats& stats) noexcept {
+    _push(stats);
+}
+
+_ym::LoadStats::Scope::Scope(const Active& active) noexcept {
+    for (size_t i = 0; i < active.count; i++) {
+        _push(*active.stats[i]);
+    }
+}
+
+_ym::LoadStats::Scope::~Scope() noexcept {
+    scopes.count -= _pushed;
+}
+
+void _ym::LoadStats::Scope::_push(LoadStats& stats) noexcept {
+    const auto end = scopes.stats.begin() + scopes.count;
+    if (std::find(scopes.stats.begin(), end, &stats) != end) {
+        return;
+    }
+    if (scopes.count == maxScopes) {
+        return; // Drop, rather than overflow.
+    }
+    scopes.stats[scopes.count++] = &stats;
+    _pushed++;
+}
+#endif
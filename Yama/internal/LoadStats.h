@@ -0,0 +1,151 @@
+
+
+#pragma once
+
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+#include "../yama/yama.h"
+
+
+namespace _ym {
+
+
+    // Loading statistics (see YmLoadStat), gathered only if YM_LOAD_STATS is defined, w/ the
+    // code gathering them otherwise being compiled out (see YM_LOAD_STAT, etc. below.)
+    //
+    // Stats are recorded to the stats of each scope (see LoadStats::Scope) active on the
+    // recording thread, rather than to stats passed around explicitly, so that the work a domain
+    // performs on behalf of a context gets recorded to the stats of both of them.
+    class LoadStats final {
+    public:
+        LoadStats() = default;
+
+
+        // Writes stats to out, indexed by YmLoadStat (w/ stats being 0 if not gathered.)
+        void get(YmUInt64* out) const noexcept;
+        void reset() noexcept;
+
+
+#if defined(YM_LOAD_STATS)
+        // Domain + context, plus some headroom.
+        static constexpr size_t maxScopes = 4;
+
+        // The stats active on a thread.
+        struct Active final {
+            std::array<LoadStats*, maxScopes> stats = {};
+            size_t count = 0;
+        };
+
+
+        // Records n to stat of the stats of each scope active on this thread.
+        static void record(YmLoadStat stat, YmUInt64 n = 1) noexcept;
+
+        // Returns the stats active on this thread, so they can be made active (via Scope) on the
+        // threads performing work on its behalf (ie. WorkerPool tasks.)
+        static Active active() noexcept;
+
+        // Makes stats active on this thread for the lifetime of the scope.
+        // Scopes of stats already active on this thread do nothing, so work isn't double counted.
+        // Scopes beyond maxScopes also do nothing (w/ their stats going unrecorded.)
+        class Scope final {
+        public:
+            explicit Scope(LoadStats& stats) noexcept;
+            // Makes each of active (ie. from another thread) active on this thread.
+            explicit Scope(const Active& active) noexcept;
+            Scope(const Scope&) = delete;
+            ~Scope() noexcept;
+            Scope& operator=(const Scope&) = delete;
+
+
+        private:
+            size_t _pushed = 0;
+
+
+            void _push(LoadStats& stats) noexcept;
+        };
+
+        // Records the wall time elapsed over the lifetime of the timer to stat.
+        class Timer final {
+        public:
+            explicit inline Timer(YmLoadStat stat) noexcept :
+                _stat(stat),
+                _start(std::chrono::steady_clock::now()) {
+            }
+            Timer(const Timer&) = delete;
+            inline ~Timer() noexcept {
+                record(_stat, YmUInt64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count()));
+            }
+            Timer& operator=(const Timer&) = delete;
+
+
+        private:
+            YmLoadStat _stat;
+            std::chrono::steady_clock::time_point _start;
+        };
+
+        // Wraps Mutex, recording time spent waiting to acquire it (shared or not) to Stat.
+        // Uncontended acquisitions aren't timed.
+        template<typename Mutex, YmLoadStat Stat>
+        class TimedMutex final {
+        public:
+            TimedMutex() = default;
+
+
+            inline void lock() {
+                if (!_m.try_lock()) {
+                    Timer timer(Stat);
+                    _m.lock();
+                }
+            }
+            inline bool try_lock() { return _m.try_lock(); }
+            inline void unlock() { _m.unlock(); }
+
+            inline void lock_shared() requires requires (Mutex m) { m.lock_shared(); } {
+                if (!_m.try_lock_shared()) {
+                    Timer timer(Stat);
+                    _m.lock_shared();
+                }
+            }
+            inline bool try_lock_shared() requires requires (Mutex m) { m.try_lock_shared(); } { return _m.try_lock_shared(); }
+            inline void unlock_shared() requires requires (Mutex m) { m.unlock_shared(); } { _m.unlock_shared(); }
+
+
+        private:
+            Mutex _m;
+        };
+
+
+    private:
+        std::array<std::atomic<YmUInt64>, YmLoadStat_Num> _stats = {};
+#endif
+    };
+
+
+    // Mutex which, if gathering load stats, records time spent waiting on it to Stat.
+#if defined(YM_LOAD_STATS)
+    template<typename Mutex, YmLoadStat Stat>
+    using StatMutex = LoadStats::TimedMutex<Mutex, Stat>;
+#else
+    template<typename Mutex, YmLoadStat Stat>
+    using StatMutex = Mutex;
+#endif
+}
+
+
+#if defined(YM_LOAD_STATS)
+// Records n to load stat YmLoadStat_[stat].
+#define YM_LOAD_STAT(stat, n) ::_ym::LoadStats::record(YmLoadStat_##stat, (n))
+// Makes stats active on this thread until the end of the enclosing block.
+// stats may also be a LoadStats::Active, to propagate stats active on another thread.
+#define YM_LOAD_STATS_SCOPE(stats) ::_ym::LoadStats::Scope _ymLoadStatsScope(stats)
+// Records the wall time until the end of the enclosing block to load stat YmLoadStat_[stat].
+#define YM_LOAD_STATS_TIMER(stat) ::_ym::LoadStats::Timer _ymLoadStatsTimer_##stat(YmLoadStat_##stat)
+#else
+#define YM_LOAD_STAT(stat, n) ((void)0)
+#define YM_LOAD_STATS_SCOPE(stats) ((void)0)
+#define YM_LOAD_STATS_TIMER(stat) ((void)0)
+#endif
+
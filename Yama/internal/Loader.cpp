@@ -2,6 +2,9 @@
 
 #include "Loader.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "general.h"
 #include "YmDm.h"
 #include "YmParcelDef.h"
@@ -11,21 +14,46 @@
 
 
 _ym::DmLoader::DmLoader() :
+    DmLoader(_BareTag{}) {
+    _adoptBuiltins();
+}
+
+_ym::DmLoader::DmLoader(_BareTag) :
     SynchronizedLoader(),
-    _ldr(_staging, _binds, _redirects) {
+    _ldr(_staging, _binds, _redirects, *this) {
     _staging.setUpstream(&_commits);
-    _bindYamaParcel();
+}
+
+const _ym::Builtins& _ym::DmLoader::builtins() {
+    static const Builtins* const result = [] {
+        // Loaded via a loader of their own, which is leaked along w/ them.
+        auto ldr = new DmLoader(_BareTag{});
+        ldr->_bindYamaParcel();
+        auto ld = [ldr](std::string_view fullname) -> std::shared_ptr<YmType> {
+            auto result = ldr->load(Spec::typeFast(fullname));
+            ymAssert(result != nullptr);
+            return result;
+            };
+        auto builtins = new Builtins{
+            .none = ld("yama:None"),
+            .int0 = ld("yama:Int"),
+            .uint = ld("yama:UInt"),
+            .float0 = ld("yama:Float"),
+            .bool0 = ld("yama:Bool"),
+            .rune = ld("yama:Rune"),
+            .type = ld("yama:Type"),
+            .any = ld("yama:Any"),
+        };
+        builtins->parcel = ldr->fetchParcel(Spec::pathFast("yama"));
+        ymAssert(builtins->parcel != nullptr);
+        return builtins;
+        }();
+    return *result;
 }
 
 bool _ym::DmLoader::bindParcelDef(const std::string& path, ym::Safe<YmParcelDef> parceldef, bool bindIsForYamaParcel) {
     if (auto p = Spec::path(path)) {
-        if (!bindIsForYamaParcel && *p == "yama") {
-            _ym::Global::raiseErr(
-                YmErrCode_PathBindError,
-                "Cannot bind parcel def.; would overwrite \"yama\" parcel!");
-            return false;
-        }
-        if (!parceldef->verify()) {
+        if (!_checkBindable(*p, *parceldef->info, bindIsForYamaParcel, "Cannot bind parcel def.")) {
             return false;
         }
         std::scoped_lock lk(_updateLock);
@@ -85,11 +113,14 @@ size_t _ym::DmLoader::forEachParcel(YmForEachParcelCallbackFn callback, void* us
 
 void _ym::DmLoader::reset() noexcept {
     std::scoped_lock lk(_accessLock, _updateLock);
-    // TODO: Should also reset _commits/_binds/_redirects? (If so, remember to call _bindYamaParcel.)
+    // TODO: Should also reset _binds/_redirects?
     _staging.discard(true);
+    // Discarding propagates to _commits, so the builtins need to be re-adopted.
+    _adoptBuiltins();
 }
 
 std::shared_ptr<YmParcel> _ym::DmLoader::fetchParcel(const Spec& path) const noexcept {
+    YM_LOAD_STATS_SCOPE(_stats);
     std::shared_lock lk(_accessLock);
     return _commits.parcels.fetch(path);
 }
@@ -103,6 +134,7 @@ std::shared_ptr<YmType> _ym::DmLoader::fetchType(const Spec& fullname, bool* fai
     //       this can call a virtual 'doFetchType' method.
     //       Also, try to update _ym::DmLoader::load to generalize it's code w/ above.
     //       Also _ym::LoaderManager::_checkRefConstCallSigConformance too.
+    YM_LOAD_STATS_SCOPE(_stats);
     std::shared_lock lk(_accessLock);
     auto result = _commits.types.fetch(fullname.removeCallSuff());
     lk.unlock(); // Don't need it anymore.
@@ -122,11 +154,14 @@ std::shared_ptr<YmType> _ym::DmLoader::fetchType(const Spec& fullname, bool* fai
 }
 
 std::shared_ptr<YmParcel> _ym::DmLoader::import(const Spec& path) {
+    YM_LOAD_STATS_SCOPE(_stats);
     if (const auto result = fetchParcel(path)) {
         return result;
     }
     std::scoped_lock lk(_updateLock);
+    _LoadingScope loading(_loadingThread);
     auto result = _ldr.import(path);
+    YM_LOAD_STATS_TIMER(CommitTime);
     _staging.commitOrDiscard(result, _accessLock);
     return
         result
@@ -135,11 +170,13 @@ std::shared_ptr<YmParcel> _ym::DmLoader::import(const Spec& path) {
 }
 
 std::shared_ptr<YmType> _ym::DmLoader::load(const Spec& fullname) {
+    YM_LOAD_STATS_SCOPE(_stats);
     bool failedDueToCallSigNonConform{};
     if (const auto result = fetchType(fullname, &failedDueToCallSigNonConform); result || failedDueToCallSigNonConform) {
         return result;
     }
     std::scoped_lock lk(_updateLock);
+    _LoadingScope loading(_loadingThread);
     auto result = _ldr.load(fullname.removeCallSuff());
     if (result && !result->checkCallSuff(fullname.callsuff())) {
         // TODO: Improve this error!
@@ -149,15 +186,223 @@ std::shared_ptr<YmType> _ym::DmLoader::load(const Spec& fullname) {
             result->fullname(),
             std::string(*fullname.callsuff()));
         _staging.discard(); // Can't forget!
+        _ldr.flushMaterialized(false);
         return nullptr;
     }
-    _staging.commitOrDiscard(result, _accessLock);
+    {
+        YM_LOAD_STATS_TIMER(CommitTime);
+        // Types only needed during loading (ie. for constraint checking) are discarded.
+        _staging.commitReachableOrDiscard(result, _accessLock);
+        _ldr.flushMaterialized(result != nullptr);
+        _scheduleCollectIfDue();
+        // Member types are committed nameless, so if one gets loaded explicitly by name, index it
+        // by name so future loads of it can be serviced by fetchType.
+        // NOTE: _commits is only mutated while _updateLock is held, so reading it here w/out
+        //       _accessLock is fine.
+        if (result && !_commits.types.exists(result->fullname())) {
+            std::scoped_lock accessLk(_accessLock);
+            _commits.types.addName(result->shared_from_this());
+        }
+    }
     return
         result
         ? result->shared_from_this()
         : nullptr;
 }
 
+YmType* _ym::DmLoader::materializeMember(YmType& owner, YmMemberIndex index) {
+    // If this thread is importing/loading, then materialization is part of that.
+    if (_loadingThread == std::this_thread::get_id()) {
+        return _ldr.materializeMember(owner, index);
+    }
+    YM_LOAD_STATS_SCOPE(_stats);
+    std::scoped_lock lk(_updateLock);
+    // Another thread may have materialized it while we were waiting.
+    if (const auto result = owner.tryMemberType(index)) {
+        return result;
+    }
+    _LoadingScope loading(_loadingThread);
+    auto result = _ldr.materializeMember(owner, index);
+    YM_LOAD_STATS_TIMER(CommitTime);
+    _staging.commitReachableOrDiscard(result, _accessLock);
+    _ldr.flushMaterialized(result != nullptr);
+    _scheduleCollectIfDue();
+    return result;
+}
+
+bool _ym::DmLoader::owns(const YmType& type) const noexcept {
+    std::shared_lock lk(_accessLock);
+    return _commits.types.existsById(type.getId());
+}
+
+size_t _ym::DmLoader::collect() {
+    std::scoped_lock collectLk(_collectLock);
+    // Instantiations get ref'd by other types, contexts, etc. via raw pointers, so we can only
+    // reclaim them if nothing outside the domain shares them (as otherwise the type graph
+    // would cease to be consistent w/ the things outside it depending upon it.)
+    auto isRoot = [](const YmType& x, bool shared) -> bool {
+        return shared || x.typeParams() == 0;
+        };
+    // Only snapshotting happens under _updateLock, w/ marking not blocking imports/loads.
+    // Holding _updateLock means _commits cannot be mutated mid-snapshot, and also lets us read
+    // _commits w/out _accessLock, so snapshotting doesn't block lookups.
+    // NOTE: Marking traverses the deps of committed types w/out _updateLock, which is fine, as
+    //       these only change upon member materialization, which publishes members atomically.
+    auto snapshot = [&] {
+        std::scoped_lock lk(_updateLock);
+        return _commits.types.snapshot(isRoot);
+        }();
+    auto candidates = Section<YmType>::mark(std::move(snapshot));
+    std::scoped_lock lk(_updateLock);
+    std::vector<std::shared_ptr<YmType>> garbage{};
+    {
+        // Lookups can acquire candidates, and loads can commit types depending upon candidates,
+        // between snapshot and here, which sweep accounts for.
+        std::scoped_lock accessLk(_accessLock);
+        garbage = _commits.types.sweep(std::move(candidates), isRoot);
+    }
+    _collectThreshold = std::max(_minCollectThreshold, _commits.types.count() * 3 / 2);
+    return garbage.size(); // Garbage is destroyed here, w/out holding _accessLock.
+}
+
+void _ym::DmLoader::writeImage(ImageWriter& w) {
+    // Holding _updateLock means neither _binds nor _commits can change mid-write, and also lets
+    // us read _commits w/out _accessLock.
+    std::scoped_lock lk(_updateLock);
+    // The yama parcel is shared by all domains, and so is never written.
+    std::vector<const YmParcel*> parcels{};
+    for (const auto& [path, parcel] : _binds) {
+        if (path != "yama") {
+            parcels.push_back(parcel.get());
+        }
+    }
+    w.u32(YmUInt32(parcels.size()));
+    for (const auto& parcel : parcels) {
+        w.str(parcel->path);
+        parcel->info->write(w);
+    }
+    w.u32(YmUInt32(_redirects.count()));
+    _redirects.forEach([&w](const Spec& subject, const Spec& before, const Spec& after) {
+        w.str(subject);
+        w.str(before);
+        w.str(after);
+        });
+    // Member types get materialized w/ their owners, so needn't be loaded explicitly.
+    std::vector<const YmType*> types{};
+    for (const auto& type : _commits.types) {
+        if (!ymKind_IsMember(type.kind())) {
+            types.push_back(&type);
+        }
+    }
+    w.u32(YmUInt32(types.size()));
+    for (const auto& type : types) {
+        w.str(type->fullname());
+    }
+}
+
+bool _ym::DmLoader::readImage(ImageReader& r, YmRelinkCallBhvrCallbackFn relink, void* user) {
+    static constexpr std::string_view msg = "Cannot load image";
+    YM_LOAD_STATS_SCOPE(_stats);
+    // Specifiers are parsed (rather than trusted to be normalized), so that images w/ corrupted
+    // specifiers fail to be read, rather than yielding illegal ones.
+    auto readSpec = [&r](bool path) -> std::optional<Spec> {
+        const auto s = std::string(r.str());
+        return
+            r.good()
+            ? (path ? Spec::path(s) : Spec::type(s))
+            : std::nullopt;
+        };
+    auto malformed = [&]() -> bool {
+        Global::raiseErr(
+            YmErrCode_ImageError,
+            "{}; image is malformed!",
+            (std::string)msg);
+        return false;
+        };
+    std::vector<std::shared_ptr<YmParcel>> parcels{};
+    const size_t parcelsN = r.u32();
+    for (size_t i = 0; i < parcelsN; i++) {
+        auto p = readSpec(true);
+        const bool duplicate =
+            p &&
+            std::ranges::any_of(parcels, [&](const auto& parcel) { return parcel->path == *p; });
+        if (!p || duplicate) {
+            return malformed();
+        }
+        auto relinker = [&](const TypeInfo& type) -> std::optional<CallBhvrCallbackInfo> {
+            CallBhvrCallbackInfo result{};
+            return
+                relink && relink(user, *p, type.localName().c_str(), &result.fn, &result.user) && result.fn
+                ? std::make_optional(result)
+                : std::nullopt;
+            };
+        auto info = ParcelInfo::read(r, relinker, msg);
+        if (!info) {
+            return false;
+        }
+        parcels.push_back(std::make_shared<YmParcel>(std::move(*p), std::move(info)));
+    }
+    struct Redirect final {
+        Spec subject, before, after;
+    };
+    std::vector<Redirect> redirects{};
+    const size_t redirectsN = r.u32();
+    for (size_t i = 0; i < redirectsN; i++) {
+        auto subject = readSpec(true);
+        auto before = readSpec(true);
+        auto after = readSpec(true);
+        if (!subject || !before || !after) {
+            return malformed();
+        }
+        redirects.push_back(Redirect{ std::move(*subject), std::move(*before), std::move(*after) });
+    }
+    std::vector<Spec> fullnames{};
+    const size_t typesN = r.u32();
+    for (size_t i = 0; i < typesN; i++) {
+        auto fullname = readSpec(false);
+        if (!fullname) {
+            return malformed();
+        }
+        fullnames.push_back(std::move(*fullname));
+    }
+    if (!r.good() || !r.done()) {
+        return malformed();
+    }
+    // Parcels are bound w/ the same checks as bindParcelDef, and only if all of them pass.
+    for (const auto& parcel : parcels) {
+        if (!_checkBindable(parcel->path, *parcel->info, false, msg)) {
+            return false;
+        }
+    }
+    {
+        std::scoped_lock lk(_updateLock);
+        for (auto& parcel : parcels) {
+            _binds.set(parcel->path, parcel);
+        }
+        for (const auto& [subject, before, after] : redirects) {
+            _redirects.add(subject, before, after);
+        }
+    }
+    bool success = true;
+    for (const auto& fullname : fullnames) {
+        if (!load(fullname)) {
+            success = false;
+        }
+    }
+    return success;
+}
+
+bool _ym::DmLoader::_checkBindable(const Spec& path, const ParcelInfo& info, bool bindIsForYamaParcel, std::string_view msg) {
+    if (!bindIsForYamaParcel && path == "yama") {
+        Global::raiseErr(
+            YmErrCode_PathBindError,
+            "{}; would overwrite \"yama\" parcel!",
+            (std::string)msg);
+        return false;
+    }
+    return info.verify();
+}
+
 void _ym::DmLoader::_bindYamaParcel() {
     auto p = ym::makeScoped<YmParcelDef>();
     p->addStruct("None", KindEx::None);
@@ -171,6 +416,45 @@ void _ym::DmLoader::_bindYamaParcel() {
     if (!bindParcelDef("yama", *p, true)) YM_DEADEND;
 }
 
+void _ym::DmLoader::_adoptBuiltins() {
+    const auto& b = builtins();
+    _binds.set(b.parcel->path, b.parcel);
+    _commits.parcels.push(b.parcel);
+    for (const auto& type : { b.none, b.int0, b.uint, b.float0, b.bool0, b.rune, b.type, b.any }) {
+        _commits.types.push(type);
+    }
+}
+
+void _ym::DmLoader::_scheduleCollectIfDue() {
+    if (_commits.types.count() < _collectThreshold) {
+        return;
+    }
+    // Don't reschedule until collection has occurred.
+    _collectThreshold = std::numeric_limits<size_t>::max();
+    {
+        std::scoped_lock lk(_collectorLock);
+        _collectRequested = true;
+    }
+    // Only bother launching the collector thread if it's actually needed.
+    if (!_collector.joinable()) {
+        _collector = std::jthread([this](std::stop_token stop) { _collectorMain(stop); });
+    }
+    _collectorCV.notify_one();
+}
+
+void _ym::DmLoader::_collectorMain(std::stop_token stop) {
+    while (true) {
+        {
+            std::unique_lock lk(_collectorLock);
+            if (!_collectorCV.wait(lk, stop, [this] { return _collectRequested; })) {
+                return; // Stop requested.
+            }
+            _collectRequested = false;
+        }
+        (void)collect();
+    }
+}
+
 _ym::CtxLoader::CtxLoader(const std::shared_ptr<Loader>& upstream) :
     UnsynchronizedLoader(),
     _upstream(upstream) {
@@ -213,6 +497,7 @@ YmType& _ym::CtxLoader::ldType() const noexcept {
 
 void _ym::CtxLoader::reset() noexcept {
     _commits.discard(true);
+    _preloadBuiltins();
 }
 
 std::shared_ptr<YmParcel> _ym::CtxLoader::fetchParcel(const Spec& path) const noexcept {
@@ -243,6 +528,7 @@ std::shared_ptr<YmParcel> _ym::CtxLoader::import(const Spec& path) {
     if (auto result = fetchParcel(path)) {
         return result;
     }
+    YM_LOAD_STATS_SCOPE(_stats);
     auto parcel = upstream()->import(path);
     return
         _commits.parcels.push(parcel)
@@ -255,6 +541,7 @@ std::shared_ptr<YmType> _ym::CtxLoader::load(const Spec& fullname) {
     if (auto result = fetchType(fullname, &failedDueToCallSigNonConform); result || failedDueToCallSigNonConform) {
         return result;
     }
+    YM_LOAD_STATS_SCOPE(_stats);
     auto type = upstream()->load(fullname);
     return
         _commits.types.push(type)
@@ -266,15 +553,26 @@ const _ym::Area& _ym::CtxLoader::commits() const {
     return _commits;
 }
 
+void _ym::CtxLoader::adopt(YmType& type) {
+    if (!_commits.types.existsById(type.getId())) {
+        _commits.types.push(type.shared_from_this());
+    }
+}
+
 void _ym::CtxLoader::_preloadBuiltins() {
+    // Builtins are shared by all domains, so needn't be loaded via upstream.
+    const auto& b = DmLoader::builtins();
+    for (const auto& type : { b.none, b.int0, b.uint, b.float0, b.bool0, b.rune, b.type }) {
+        _commits.types.push(type);
+    }
     _builtins = _Builtins{
-        .none = ym::deref(load(Spec::typeFast("yama:None"))),
-        .int0 = ym::deref(load(Spec::typeFast("yama:Int"))),
-        .uint = ym::deref(load(Spec::typeFast("yama:UInt"))),
-        .float0 = ym::deref(load(Spec::typeFast("yama:Float"))),
-        .bool0 = ym::deref(load(Spec::typeFast("yama:Bool"))),
-        .rune = ym::deref(load(Spec::typeFast("yama:Rune"))),
-        .type = ym::deref(load(Spec::typeFast("yama:Type"))),
+        .none = ym::deref(b.none),
+        .int0 = ym::deref(b.int0),
+        .uint = ym::deref(b.uint),
+        .float0 = ym::deref(b.float0),
+        .bool0 = ym::deref(b.bool0),
+        .rune = ym::deref(b.rune),
+        .type = ym::deref(b.type),
     };
 }
 
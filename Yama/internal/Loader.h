@@ -3,15 +3,21 @@
 #pragma once
 
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <optional>
 #include <shared_mutex>
+#include <stop_token>
 #include <string>
+#include <thread>
 
 #include "../yama/yama.h"
 #include "Area.h"
 #include "general.h"
+#include "Image.h"
 #include "LoadManager.h"
+#include "LoadStats.h"
 #include "PathBindings.h"
 #include "Redirects.h"
 #include "YmType.h"
@@ -48,6 +54,14 @@ namespace _ym {
         // Acquires type, attempting load if necessary.
         // In synchronized loaders this is guaranteed to be thread-safe.
         virtual std::shared_ptr<YmType> load(const Spec& fullname) = 0;
+
+        // Stats of the imports/loads performed via the loader.
+        // This is thread-safe.
+        inline LoadStats& stats() const noexcept { return _stats; }
+
+
+    protected:
+        mutable LoadStats _stats;
     };
 
     // Base class of all unsynchronized loader.
@@ -66,12 +80,24 @@ namespace _ym {
         SynchronizedLoader() = default;
     };
 
+    // The builtin "yama" parcel, and its types, which are loaded once per process, and then
+    // shared by all domains (and their contexts), so creating them involves no loading work.
+    // These are immortal, and so are never reclaimed.
+    struct Builtins final {
+        std::shared_ptr<YmParcel> parcel;
+        std::shared_ptr<YmType> none, int0, uint, float0, bool0, rune, type, any;
+    };
+
     // Thread-safe loader used by domains, servicing downstream contexts loaders.
-    class DmLoader final : public SynchronizedLoader {
+    // Also materializes member types for the types it loads.
+    class DmLoader final : public SynchronizedLoader, public MemberMaterializer {
     public:
         DmLoader();
 
 
+        // Returns the builtins, loading them upon first call. Thread-safe.
+        static const Builtins& builtins();
+
         bool bindParcelDef(const std::string& path, ym::Safe<YmParcelDef> parceldef, bool bindIsForYamaParcel = false);
         bool addRedirect(const std::string& subject, const std::string& before, const std::string& after);
         size_t forEachParcel(YmForEachParcelCallbackFn callback, void* user, YmDm* dm);
@@ -81,9 +107,54 @@ namespace _ym {
         std::shared_ptr<YmType> fetchType(const Spec& fullname, bool* failedDueToCallSigNonConform = nullptr) const noexcept override;
         std::shared_ptr<YmParcel> import(const Spec& path) override;
         std::shared_ptr<YmType> load(const Spec& fullname) override;
+        YmType* materializeMember(YmType& owner, YmMemberIndex index) override;
+        // Returns if type is one of our committed types (ie. rather than another domain's.)
+        bool owns(const YmType& type) const noexcept;
+
+        // Reclaims committed generic type instantiations (and their members) which are no longer
+        // in use, returning the number of types reclaimed.
+        // Types are in use if they're non-generic, if they're shared w/ things outside the domain
+        // (ie. context loaders), or if they're reachable from types which are in use.
+        // Blocks imports/loads only while snapshotting _commits, and while removing the reclaimed
+        // types from _commits, w/ lookups being blocked only for the latter.
+        // Pooled contexts don't keep types in use (see YmDm::returnCtx.)
+        size_t collect();
+
+        // Writes the parcels bound to the loader (other than yama), its redirects, and the
+        // (non-member) types it has loaded, to w.
+        void writeImage(ImageWriter& w);
+        // Reads an image written by writeImage from r, binding its parcels, adding its redirects,
+        // and then loading its types, returning if successful.
+        // Non-builtin call behaviours are relinked via relink (if any.)
+        // Parcels/redirects are only bound/added if all of them are read (and pass the checks of
+        // bindParcelDef/addRedirect) successfully, but stay bound/added even if types thereafter
+        // fail to load.
+        bool readImage(ImageReader& r, YmRelinkCallBhvrCallbackFn relink, void* user);
 
 
     private:
+        struct _BareTag final {};
+
+        // Constructs a loader w/out the builtins (ie. to load them.)
+        explicit DmLoader(_BareTag);
+
+
+        // Marks the calling thread as holding _updateLock to import/load/materialize, so
+        // materialization arising therein can be detected, and performed inline.
+        struct _LoadingScope final {
+            std::atomic<std::thread::id>& loadingThread;
+
+
+            inline _LoadingScope(std::atomic<std::thread::id>& loadingThread) :
+                loadingThread(loadingThread) {
+                loadingThread = std::this_thread::get_id();
+            }
+            inline ~_LoadingScope() noexcept {
+                loadingThread = std::thread::id{};
+            }
+        };
+
+
         PathBindings _binds;
         Redirects _redirects;
         Area _commits, _staging;
@@ -91,11 +162,35 @@ namespace _ym {
 
         // NOTE: _updateLock protects _binds/_redirects as their data is used during loading.
 
-        mutable std::shared_mutex _accessLock; // Protects _commits.
-        mutable std::mutex _updateLock; // Protects _staging/_binds/_redirects/_ldrState.
+        mutable StatMutex<std::shared_mutex, YmLoadStat_AccessLockWaitTime> _accessLock; // Protects _commits.
+        mutable StatMutex<std::mutex, YmLoadStat_UpdateLockWaitTime> _updateLock; // Protects _staging/_binds/_redirects/_ldrState.
+        std::atomic<std::thread::id> _loadingThread;
+
+        // Collection is scheduled (on _collector) once the number of committed types grows past
+        // _collectThreshold, which is reset after each collection cycle relative to the number
+        // of types which survived it.
 
+        static constexpr size_t _minCollectThreshold = 1024;
+
+        size_t _collectThreshold = _minCollectThreshold; // Protected by _updateLock.
+        std::mutex _collectLock; // Serializes collection cycles.
+        std::mutex _collectorLock; // Protects _collectRequested.
+        std::condition_variable_any _collectorCV;
+        bool _collectRequested = false;
+        std::jthread _collector; // Declared last, so it's joined before the rest of us is destroyed.
+
+
+        // Checks that info may be bound to path, raising errors prefixed by msg if not.
+        // Both bindParcelDef and readImage bind parcels only once they pass this.
+        bool _checkBindable(const Spec& path, const ParcelInfo& info, bool bindIsForYamaParcel, std::string_view msg);
 
         void _bindYamaParcel();
+        // Binds and commits the builtins, such that they needn't be imported/loaded.
+        void _adoptBuiltins();
+
+        // Call only while _updateLock is held.
+        void _scheduleCollectIfDue();
+        void _collectorMain(std::stop_token stop);
     };
 
     // Thread-unsafe loader used by contexts, existing downstream of domain loaders.
@@ -121,6 +216,10 @@ namespace _ym {
         std::shared_ptr<YmType> load(const Spec& fullname) override;
         const Area& commits() const override;
 
+        // Commits type (if not already committed), w/out resolving it, so it outlives objects
+        // of it which arrive from other contexts.
+        void adopt(YmType& type);
+
 
     private:
         struct _Builtins final {
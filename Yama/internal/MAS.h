@@ -3,17 +3,28 @@
 #pragma once
 
 
+#include <cstdlib>
+#include <optional>
+#include <utility>
+
+#include "../yama/yama.h"
 #include "../yama++/meta.h"
 #include "../yama++/Safe.h"
 #include "../yama++/Variant.h"
 
 
-// TODO: The below code unfinished, but is REALLY GOOD, and is for when we want to commit
-//       to switching from abstract base class based MASs, to template based ones.
-#if 0
 namespace _ym {
 
 
+    // NOTE: One of the reasons I'm using MAS over memory_resource is that the ladder forces
+    //		 us to use a memory_resource impl middle-man in order to do things like tracking
+    //		 memory usage stats when using something like unsynchronized_pool_resource.
+
+    // NOTE: MASs are templates (rather than deriving from an abstract base class) so that
+    //       allocating/deallocating memory for Yama objects doesn't pay for dynamic dispatch,
+    //       w/ ChoiceMAS letting which MAS to use be chosen at runtime, w/out vtables.
+
+
     // Models Memory Allocation Systems (MASs).
     template<typename T>
     concept MAS =
@@ -27,7 +38,7 @@ namespace _ym {
 
         // NOTE: Must be able to dealloc blocks w/out explicitly being told what its size is.
 
-        // Fails quietly if p == nullptr.
+        // Fails quietly if block == nullptr.
         { v.deallocate(block) } noexcept;
     };
 
@@ -38,7 +49,7 @@ namespace _ym {
         requires (T v)
     {
         // NOTE: 'reset' must be called by dtor.
-        
+
         // Releases all allocated memory.
         { v.reset() } noexcept;
     };
@@ -49,14 +60,16 @@ namespace _ym {
         DummyMAS() = default;
         ~DummyMAS() noexcept = default;
         DummyMAS(const DummyMAS&) = default;
-        DummyMAS(DummyMAS&) noexcept = default;
+        DummyMAS(DummyMAS&&) noexcept = default;
         DummyMAS& operator=(const DummyMAS&) = default;
-        DummyMAS& operator=(DummyMAS&) noexcept = default;
+        DummyMAS& operator=(DummyMAS&&) noexcept = default;
+
 
+        bool operator==(const DummyMAS&) const noexcept = default;
 
         constexpr void* allocate(size_t) { return nullptr; }
         constexpr void deallocate(void*) noexcept {}
-        constexpr void release() noexcept {}
+        constexpr void reset() noexcept {}
     };
 
     static_assert(OwningMAS<DummyMAS>);
@@ -67,11 +80,13 @@ namespace _ym {
         HeapMAS() = default;
         ~HeapMAS() noexcept = default;
         HeapMAS(const HeapMAS&) = default;
-        HeapMAS(HeapMAS&) noexcept = default;
+        HeapMAS(HeapMAS&&) noexcept = default;
         HeapMAS& operator=(const HeapMAS&) = default;
-        HeapMAS& operator=(HeapMAS&) noexcept = default;
+        HeapMAS& operator=(HeapMAS&&) noexcept = default;
 
 
+        bool operator==(const HeapMAS&) const noexcept = default;
+
         inline void* allocate(size_t bytes) {
             return std::malloc(bytes);
         }
@@ -85,7 +100,57 @@ namespace _ym {
     static_assert(MAS<HeapMAS>);
 
 
-    // C++ allocator used to allocate/deallocate using a MAS in a type-erased manner.
+    // MAS which forwards to an end-user supplied allocator (see YmAllocator.)
+    class ExternMAS final {
+    public:
+        inline explicit ExternMAS(const YmAllocator& allocator) :
+            _allocator(allocator) {
+            ymAssert(_allocator.allocate != nullptr);
+            ymAssert(_allocator.deallocate != nullptr);
+        }
+
+        ExternMAS() = delete;
+        ~ExternMAS() noexcept = default;
+        ExternMAS(const ExternMAS&) = default;
+        ExternMAS(ExternMAS&&) noexcept = default;
+        ExternMAS& operator=(const ExternMAS&) = default;
+        ExternMAS& operator=(ExternMAS&&) noexcept = default;
+
+
+        inline bool operator==(const ExternMAS& other) const noexcept {
+            return
+                _allocator.user == other._allocator.user &&
+                _allocator.allocate == other._allocator.allocate &&
+                _allocator.deallocate == other._allocator.deallocate;
+        }
+
+
+        inline void* allocate(size_t bytes) {
+            return _allocator.allocate(_allocator.user, bytes);
+        }
+        inline void deallocate(void* block) noexcept {
+            if (block) {
+                _allocator.deallocate(_allocator.user, block);
+            }
+        }
+
+
+    private:
+        YmAllocator _allocator;
+    };
+
+    static_assert(MAS<ExternMAS>);
+
+    // Returns if a and b specify the same allocator, w/ std::nullopt specifying the default one.
+    inline bool sameAllocator(const std::optional<YmAllocator>& a, const std::optional<YmAllocator>& b) noexcept {
+        if (!a || !b) {
+            return !a && !b;
+        }
+        return ExternMAS(*a) == ExternMAS(*b);
+    }
+
+
+    // C++ allocator used to allocate/deallocate using a MAS.
     template<MAS MAST, typename T>
     class AllocFor final {
     public:
@@ -100,13 +165,17 @@ namespace _ym {
         inline AllocFor(MAST& mas) :
             _mas(mas) {
         }
+        template<typename Other>
+        inline AllocFor(const AllocFor<MAST, Other>& other) noexcept :
+            AllocFor(*other._mas) {
+        }
 
         AllocFor() = delete;
         ~AllocFor() noexcept = default;
         AllocFor(const AllocFor&) = default;
-        AllocFor(AllocFor&) noexcept = default;
+        AllocFor(AllocFor&&) noexcept = default;
         AllocFor& operator=(const AllocFor&) = default;
-        AllocFor& operator=(AllocFor&) noexcept = default;
+        AllocFor& operator=(AllocFor&&) noexcept = default;
 
 
         bool operator==(const AllocFor&) const noexcept = default;
@@ -121,12 +190,19 @@ namespace _ym {
 
 
     private:
+        template<MAS, typename>
+        friend class AllocFor;
+
+
         ym::Safe<MAST> _mas;
     };
 
     static_assert(ym::Allocator<AllocFor<HeapMAS, int>>);
 
 
+    // MAS which forwards to one of Ts, chosen upon init.
+    // Dispatch is done by checking each alternative in order, so the first alternative is the
+    // cheapest to use, and none involve indirect calls (beyond what the alternatives themselves do.)
     template<MAS... Ts>
     class ChoiceMAS final {
     public:
@@ -136,11 +212,22 @@ namespace _ym {
         }
 
         ChoiceMAS() = delete;
-        ~ChoiceMAS() noexcept = default;
-        ChoiceMAS(const ChoiceMAS&) = default;
-        ChoiceMAS(ChoiceMAS&) noexcept = default;
-        ChoiceMAS& operator=(const ChoiceMAS&) = default;
-        ChoiceMAS& operator=(ChoiceMAS&) noexcept = default;
+        inline ~ChoiceMAS() noexcept {
+            reset();
+        }
+        // Non-copyable, as copies would each reset (ie. release) the same memory upon destruction.
+        ChoiceMAS(const ChoiceMAS&) = delete;
+        // Moving leaves other's chosen MAS moved-from, w/ it being up to that MAS to ensure that
+        // resetting it then doesn't release memory now owned by us.
+        ChoiceMAS(ChoiceMAS&&) noexcept = default;
+        ChoiceMAS& operator=(const ChoiceMAS&) = delete;
+        inline ChoiceMAS& operator=(ChoiceMAS&& other) noexcept {
+            if (this != &other) {
+                reset(); // Release our memory before overwriting our chosen MAS.
+                _mas = std::move(other._mas);
+            }
+            return *this;
+        }
 
 
         inline void* allocate(size_t bytes) {
@@ -149,8 +236,14 @@ namespace _ym {
         inline void deallocate(void* block) noexcept {
             _dealloc(block);
         }
+        // Releases all allocated memory, if the chosen MAS is an OwningMAS.
         inline void reset() noexcept {
-            // TODO
+            _resetEach(std::make_index_sequence<_Variant::size>{});
+        }
+
+        template<typename T>
+        inline AllocFor<ChoiceMAS, T> allocator() noexcept {
+            return AllocFor<ChoiceMAS, T>(*this);
         }
 
 
@@ -163,7 +256,7 @@ namespace _ym {
         template<size_t I>
             requires ym::validPackIndex<I, Ts...>
         inline bool _attemptAllocWithAltAtIndex(void*& result, size_t bytes) {
-            if (auto mas = _mas.tryAs<I>()) {
+            if (auto mas = _mas.template tryAs<I>()) {
                 result = mas->allocate(bytes);
                 return true;
             }
@@ -183,7 +276,7 @@ namespace _ym {
         template<size_t I>
             requires ym::validPackIndex<I, Ts...>
         inline bool _attemptDeallocWithAltAtIndex(void* block) noexcept {
-            if (auto mas = _mas.tryAs<I>()) {
+            if (auto mas = _mas.template tryAs<I>()) {
                 mas->deallocate(block);
                 return true;
             }
@@ -200,179 +293,35 @@ namespace _ym {
             }
         }
 
-        template<MAS T>
-        struct _Releaser final {
-            inline void operator()(T& mas) noexcept {}
-        };
-        template<OwningMAS T>
-        struct _Releaser final {
-            inline void operator()(T& mas) noexcept {
-                mas.release();
-            }
-        };
-    };
-
-    static_assert(OwningMAS<ChoiceMAS<DummyMAS, HeapMAS>>);
-}
-#endif
-
-namespace _ym {
-
-
-    // TODO: Maybe replace vtable stuff w/ generics? We could then impl a 'ChoiceMAS' monadic
-    //       class which lets us have multiple different MAS's be available for init at runtime
-    //       based on what index value is chosen at init time.
-
-    // NOTE: One of the reasons I'm using MAS over memory_resource is that the ladder forces
-    //		 us to use a memory_resource impl middle-man in order to do things like tracking
-    //		 memory usage stats when using something like unsynchronized_pool_resource.
-
-    
-    // Base class of fast Memory Allocation Systems (MASs).
-    class MAS {
-    public:
-        template<typename T>
-        class Allocator;
-
-
-        virtual ~MAS() noexcept = default;
-
-
-        inline void* allocate(size_t bytes) {
-            return doAllocate(bytes);
+        template<size_t... Is>
+        inline void _resetEach(std::index_sequence<Is...>) noexcept {
+            (_resetAltAtIndex<Is>(), ...);
         }
-        inline void deallocate(void* block) noexcept {
-            if (block) {
-                doDeallocate(block);
+        template<size_t I>
+        inline void _resetAltAtIndex() noexcept {
+            using Alt = typename _Variant::template Alt<I>;
+            if constexpr (OwningMAS<Alt>) {
+                if (auto mas = _mas.template tryAs<I>()) {
+                    mas->reset();
+                }
             }
         }
-
-        template<typename T>
-        inline Allocator<T> allocator() noexcept {
-            return Allocator<T>(*this);
-        }
-
-
-    protected:
-        // TODO: I'm really not 100% sure how I feel about using virtual methods for the
-        //		 central allocation/deallocation of memory for Yama objects.
-        //
-        //		 The reason is that vtable-based dynamic dispatch adds more overhead to
-        //		 EVERY allocate/deallocate in the form of memory indirection, which in turn
-        //		 may lead to data cache misses.
-        //
-        //		 MAYBE the fact that the same vtable will be tapped over-and-over again by
-        //		 the object system will lead to better cache performance, but this too is
-        //		 at present just a hypothesis.
-        //
-        //		 For now we'll just use these virtual methods, but later on we should do
-        //		 benchmarking to see their performance impact.
-
-        // NOTE: MAS impls must be able to dealloc blocks w/out explicitly being told what
-        //		 its size is.
-        
-        // NOTE: Allocated blocks must have alignment alignof(std::max_align_t).
-
-        virtual void* doAllocate(size_t bytes) = 0;
-        virtual void doDeallocate(void* block) noexcept = 0;
-    };
-
-    // C++ allocator used to allocate/deallocate using a MAS in a type-erased manner.
-    template<typename T>
-    class MAS::Allocator final {
-    public:
-        using value_type = T;
-
-        template<typename U>
-        struct rebind final {
-            using other = Allocator<U>;
-        };
-
-
-        inline Allocator(MAS& mas) :
-            _mas(mas) {
-        }
-        template<typename Other>
-        inline Allocator(const Allocator<Other>& other) noexcept :
-            Allocator(*other._mas) {
-        }
-
-        Allocator() = delete;
-        ~Allocator() noexcept = default;
-        Allocator(const Allocator&) = default;
-        Allocator(Allocator&) noexcept = default;
-        Allocator& operator=(const Allocator&) = default;
-        Allocator& operator=(Allocator&) noexcept = default;
-
-
-        bool operator==(const Allocator&) const noexcept = default;
-
-        inline value_type* allocate(size_t n) {
-            return (value_type*)_mas->allocate(n * sizeof(value_type));
-        }
-        // The size n is not actually used by the MAS.
-        inline void deallocate(value_type* block, size_t n) noexcept {
-            _mas->deallocate(block);
-        }
-
-
-    private:
-        template<typename Other>
-        friend class Allocator;
-
-
-        ym::Safe<MAS> _mas;
-    };
-
-    static_assert(ym::Allocator<MAS::Allocator<int>>);
-
-    // Base class of MASs which retain knowledge of all memory they allocate, and can release it all at once.
-    // All allocated memory is released upon MAS destruction.
-    class OwningMAS : public MAS {
-    public:
-        inline ~OwningMAS() noexcept {
-            reset();
-        }
-
-
-        // Releasing all allocated memory.
-        inline void reset() noexcept {
-            doReset();
-        }
-
-
-    protected:
-        virtual void doReset() noexcept = 0;
-    };
-
-
-    class DummyMAS final : public MAS {
-    public:
-        DummyMAS() = default;
-
-
-    protected:
-        inline void* doAllocate(size_t bytes) override {
-            return nullptr;
-        }
-        inline void doDeallocate(void* block) noexcept override {
-            //
-        }
     };
 
+    static_assert(MAS<ChoiceMAS<DummyMAS, HeapMAS>>);
+    static_assert(OwningMAS<ChoiceMAS<DummyMAS, HeapMAS>>);
+    static_assert(!std::copy_constructible<ChoiceMAS<DummyMAS, HeapMAS>>);
 
-    class HeapMAS final : public MAS {
-    public:
-        HeapMAS() = default;
 
+    // The MAS contexts allocate objects w/, which is either the heap (the default), or an
+    // end-user supplied allocator.
+    using CtxMAS = ChoiceMAS<HeapMAS, ExternMAS>;
 
-    protected:
-        inline void* doAllocate(size_t bytes) override {
-            return std::malloc(bytes);
+    inline CtxMAS makeCtxMAS(const std::optional<YmAllocator>& allocator) {
+        if (allocator) {
+            return CtxMAS(ExternMAS(*allocator));
         }
-        inline void doDeallocate(void* block) noexcept override {
-            std::free(block);
-        }
-    };
+        return CtxMAS(HeapMAS{});
+    }
 }
 
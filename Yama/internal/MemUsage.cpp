@@ -0,0 +1,33 @@
+#include "MemUsage.h"
+
+#include <algorithm>
+
+
+void _ym::MemUsage::get(YmUInt64* out) const noexcept {
+    ymAssert(out != nullptr);
+    std::copy(_total.begin(), _total.end(), out);
+}
+
+YmUInt64 _ym::MemUsage::bytes() const noexcept {
+    return _total[YmMemStat_Bytes];
+}
+
+void _ym::MemUsage::alloc(size_t bytes) noexcept {
+    _total[YmMemStat_Bytes] += bytes;
+    _total[YmMemStat_PeakBytes] = std::max(_total[YmMemStat_PeakBytes], _total[YmMemStat_Bytes]);
+    _total[YmMemStat_Objects]++;
+    _total[YmMemStat_Allocations]++;
+}
+
+void _ym::MemUsage::dealloc(size_t bytes) noexcept {
+    ymAssert(_total[YmMemStat_Bytes] >= bytes);
+    ymAssert(_total[YmMemStat_Objects] >= 1);
+    _total[YmMemStat_Bytes] -= bytes;
+    _total[YmMemStat_Objects]--;
+}
+
+void _ym::MemUsage::reset() noexcept {
+    ymAssert(_total[YmMemStat_Objects] == 0);
+    _total = {};
+}
+
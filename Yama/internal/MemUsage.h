@@ -0,0 +1,36 @@
+
+
+#pragma once
+
+
+#include <array>
+
+#include "../yama/yama.h"
+
+
+namespace _ym {
+
+
+    // Memory usage statistics (see YmMemStat) of the objects of a context, in total.
+    // Stats broken down by object type aren't tracked here, but are instead computed upon query
+    // (see YmCtx::memUsage), so allocating/deallocating objects needn't pay for a lookup.
+    class MemUsage final {
+    public:
+        MemUsage() = default;
+
+
+        // Writes stats to out, indexed by YmMemStat.
+        void get(YmUInt64* out) const noexcept;
+        YmUInt64 bytes() const noexcept;
+
+        void alloc(size_t bytes) noexcept;
+        void dealloc(size_t bytes) noexcept;
+        // Resets stats to 0, which requires all objects to have been deallocated.
+        void reset() noexcept;
+
+
+    private:
+        std::array<YmUInt64, YmMemStat_Num> _total = {};
+    };
+}
+
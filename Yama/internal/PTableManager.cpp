@@ -2,6 +2,8 @@
 
 #include "PTableManager.h"
 
+#include "LoadStats.h"
+
 
 std::optional<const ym::Safe<YmType>*> _ym::PTableManager::fetch(YmType& proto, YmType& boxed) const noexcept {
     if (auto it = _ptables.find(_mkKey(proto, boxed)); it != _ptables.end()) {
@@ -17,6 +19,14 @@ std::optional<const ym::Safe<YmType>*> _ym::PTableManager::load(YmType& proto, Y
     return _generate(proto, boxed);
 }
 
+size_t _ym::PTableManager::size() const noexcept {
+    return _ptables.size();
+}
+
+void _ym::PTableManager::reset() noexcept {
+    _ptables.clear();
+}
+
 std::optional<const ym::Safe<YmType>*> _ym::PTableManager::_generate(YmType& proto, YmType& boxed) {
     ymAssert(!fetch(proto, boxed));
     if (!boxed.conforms(proto)) {
@@ -25,11 +35,13 @@ std::optional<const ym::Safe<YmType>*> _ym::PTableManager::_generate(YmType& pro
     std::vector<ym::Safe<YmType>> ptable{};
     ptable.reserve(proto.members());
     for (YmMemberIndex i = 0; i < proto.members(); i++) {
-        auto& localName = proto.member(i)->type().localName();
+        // Materialized already by conforms.
+        auto& localName = ym::deref(proto.member(i)->type()).localName();
         const auto [_, memberName] = _ym::split_s<YmChar>(localName, "::");
         // TODO: This std::string alloc is suboptimal.
-        ptable.push_back(boxed.member((std::string)memberName).value().type());
+        ptable.push_back(ym::Safe(boxed.member((std::string)memberName).value().type()));
     }
+    YM_LOAD_STAT(PTablesBuilt, 1);
     return _ptables.try_emplace(_mkKey(proto, boxed), std::move(ptable)).first->second.data();
 }
 
@@ -48,6 +48,9 @@ namespace _ym {
 
 		std::optional<const ym::Safe<YmType>*> fetch(YmType& proto, YmType& boxed) const noexcept;
 		std::optional<const ym::Safe<YmType>*> load(YmType& proto, YmType& boxed);
+		// Returns the number of ptables built.
+		size_t size() const noexcept;
+		void reset() noexcept;
 
 
 	private:
@@ -23,6 +23,35 @@ std::optional<_ym::Spec> _ym::normalizeRefSym(const std::string& symbol, std::st
     return std::nullopt;
 }
 
+bool _ym::isLegalName(std::string_view name) {
+    if (name.empty()) {
+        return false;
+    }
+    bool first = true; // If we're at first char (ie. it cannot be a digit.)
+    for (taul::decoder<char> d(taul::utf8, name); !d.done();) {
+        if (auto dr = d.next()) {
+            if (!taul::is_unicode(dr->cp)) {
+                return false;
+            }
+            if (!taul::in_codepoint_range(dr->cp, U'a', U'z') &&
+                !taul::in_codepoint_range(dr->cp, U'A', U'Z') &&
+                !taul::in_codepoint_range(dr->cp, U'0', U'9') &&
+                dr->cp != U'_' &&
+                taul::is_ascii(dr->cp)) {
+                return false;
+            }
+            if (first && taul::in_codepoint_range(dr->cp, U'0', U'9')) {
+                return false;
+            }
+        }
+        else {
+            return false;
+        }
+        first = false;
+    }
+    return true;
+}
+
 bool _ym::checkHasCallSig(const TypeInfo& type, std::string_view msg) {
     bool result = ymKind_HasCallSig(type.kind());
     if (!result) {
@@ -320,7 +349,7 @@ const std::string& _ym::TypeInfo::ownerName() const noexcept {
 }
 
 const std::string& _ym::TypeInfo::memberName() const noexcept {
-    static const std::string empty = "";
+    static const IStr empty{};
     return
         _membership
         ? _membership->memberName
@@ -345,7 +374,7 @@ const _ym::TypeInfo::TypeParam* _ym::TypeInfo::typeParam(ConstIndex index) const
         : nullptr;
 }
 
-const _ym::TypeInfo::TypeParam* _ym::TypeInfo::typeParam(const std::string& name) const noexcept {
+const _ym::TypeInfo::TypeParam* _ym::TypeInfo::typeParam(std::string_view name) const noexcept {
     return
         _typeParams
         ? _typeParams->byName(name)
@@ -366,7 +395,7 @@ const _ym::TypeInfo::Member* _ym::TypeInfo::member(ConstIndex index) const noexc
         : nullptr;
 }
 
-const _ym::TypeInfo::Member* _ym::TypeInfo::member(const std::string& name) const noexcept {
+const _ym::TypeInfo::Member* _ym::TypeInfo::member(std::string_view name) const noexcept {
     return
         _members
         ? _members->byName(name)
@@ -505,16 +534,17 @@ std::optional<YmParamIndex> _ym::TypeInfo::addParam(std::string name, std::strin
     return std::nullopt;
 }
 
-void _ym::TypeInfo::beginNamedParams() {
+bool _ym::TypeInfo::beginNamedParams() {
     if (!checkHasCallSig(*this, "Cannot begin named params")) {
-        return;
+        return false;
     }
     if (!checkNonProtocolMember(*this, "Cannot begin named params")) {
-        return;
+        return false;
     }
     if (_call) {
         _call->beginNamedParams();
     }
+    return true;
 }
 
 std::optional<YmRef> _ym::TypeInfo::addRef(std::string symbol) {
@@ -569,6 +599,239 @@ std::string _ym::TypeInfo::fullnameForRef() const {
     return std::format("%here:{}", localName());
 }
 
+namespace {
+    // Builtin call behaviours are written to images by id, w/ all others instead having to be
+    // relinked when read.
+    enum class CallBhvrId : YmUInt8 {
+        Inert = 0,
+        NonBuiltin,
+        MethodReq,
+        StoredPropertyGet,
+        StoredPropertySet,
+        StoredVarGet,
+        StoredVarSet,
+
+        Num, // Enum size. Not a call behaviour id.
+    };
+
+    CallBhvrId callBhvrIdOf(YmCallBhvrCallbackFn fn) noexcept {
+        if (fn == ymInertCallBhvrFn)                        return CallBhvrId::Inert;
+        else if (fn == _ym::methodReqCallBhvr)              return CallBhvrId::MethodReq;
+        else if (fn == _ym::storedPropertyGetCallBhvr)      return CallBhvrId::StoredPropertyGet;
+        else if (fn == _ym::storedPropertySetCallBhvr)      return CallBhvrId::StoredPropertySet;
+        else if (fn == _ym::storedVarGetCallBhvr)           return CallBhvrId::StoredVarGet;
+        else if (fn == _ym::storedVarSetCallBhvr)           return CallBhvrId::StoredVarSet;
+        else                                                return CallBhvrId::NonBuiltin;
+    }
+
+    YmCallBhvrCallbackFn builtinCallBhvr(CallBhvrId id) noexcept {
+        switch (id) {
+        case CallBhvrId::Inert:                 return ymInertCallBhvrFn;
+        case CallBhvrId::MethodReq:             return _ym::methodReqCallBhvr;
+        case CallBhvrId::StoredPropertyGet:     return _ym::storedPropertyGetCallBhvr;
+        case CallBhvrId::StoredPropertySet:     return _ym::storedPropertySetCallBhvr;
+        case CallBhvrId::StoredVarGet:          return _ym::storedVarGetCallBhvr;
+        case CallBhvrId::StoredVarSet:          return _ym::storedVarSetCallBhvr;
+        default:                                return nullptr;
+        }
+    }
+
+    void writeConst(_ym::ImageWriter& w, const _ym::ConstInfo& x) {
+        static_assert(_ym::ConstTypes == 6);
+        const auto t = _ym::constTypeOf(x);
+        w.u8(YmUInt8(t));
+        switch (t) {
+        case _ym::ConstType::Int:   w.i64(x.as<YmInt>());                   break;
+        case _ym::ConstType::UInt:  w.u64(x.as<YmUInt>());                  break;
+        case _ym::ConstType::Float: w.f64(x.as<YmFloat>());                 break;
+        case _ym::ConstType::Bool:  w.u8(YmUInt8(x.as<YmBool>()));          break;
+        case _ym::ConstType::Rune:  w.u32(YmUInt32(x.as<YmRune>()));        break;
+        case _ym::ConstType::Ref:   w.str(x.as<_ym::RefInfo>().sym);        break;
+        default:                    YM_DEADEND;                             break;
+        }
+    }
+
+    std::optional<_ym::ConstInfo> readConst(_ym::ImageReader& r) {
+        static_assert(_ym::ConstTypes == 6);
+        switch (_ym::ConstType(r.u8())) {
+        case _ym::ConstType::Int:   return _ym::ConstInfo(YmInt(r.i64()));
+        case _ym::ConstType::UInt:  return _ym::ConstInfo(YmUInt(r.u64()));
+        case _ym::ConstType::Float: return _ym::ConstInfo(YmFloat(r.f64()));
+        case _ym::ConstType::Bool:  return _ym::ConstInfo(YmBool(r.u8()));
+        case _ym::ConstType::Rune:  return _ym::ConstInfo(YmRune(r.u32()));
+        case _ym::ConstType::Ref:
+        {
+            const auto sym = r.str();
+            // Symbols are parsed again (rather than trusted to be normalized), so that images w/
+            // corrupted symbols fail to be read, rather than yielding illegal specifiers.
+            auto spec = r.good() ? _ym::Spec::type(std::string(sym)) : std::nullopt;
+            return
+                spec
+                ? std::make_optional(_ym::ConstInfo(_ym::RefInfo{ .sym = std::move(*spec) }))
+                : std::nullopt;
+        }
+        default:                    return std::nullopt;
+        }
+    }
+
+    bool raiseMalformed(std::string_view msg) {
+        _ym::Global::raiseErr(
+            YmErrCode_ImageError,
+            "{}; image is malformed!",
+            (std::string)msg);
+        return false;
+    }
+}
+
+void _ym::TypeInfo::write(ImageWriter& w) const {
+    w.u8(YmUInt8(kindEx()));
+    w.str(localName());
+    w.u16(slots);
+    w.u32(YmUInt32(consts.size()));
+    for (ConstIndex i = 0; i < consts.size(); i++) {
+        writeConst(w, consts[i]);
+    }
+    w.u32(YmUInt32(refs.size()));
+    for (const auto& ref : refs) {
+        w.u32(YmUInt32(ref));
+    }
+    // Members aren't written, as they get registered w/ us again as their types are read.
+    w.u16(YmUInt16(typeParams()));
+    for (YmTypeParamIndex i = 0; i < typeParams(); i++) {
+        const auto& typeParam = ym::deref(this->typeParam(i));
+        w.str(typeParam.name);
+        w.u32(YmUInt32(typeParam.constraintConst));
+    }
+    w.u8(YmUInt8(_call != nullptr));
+    if (_call) {
+        const auto id = callBhvrIdOf(_call->callBehaviour.fn);
+        w.u8(YmUInt8(id));
+        // The user data of builtin call behaviours is never a pointer (ie. it's a member index
+        // or slot), so it can be written as is.
+        if (id != CallBhvrId::Inert && id != CallBhvrId::NonBuiltin) {
+            w.u64(YmUInt64(std::uintptr_t(_call->callBehaviour.user)));
+        }
+        w.u8(YmUInt8(_call->assignerConst.has_value()));
+        w.u32(YmUInt32(_call->assignerConst.value_or(0)));
+        w.u32(YmUInt32(_call->returnTypeConst));
+        w.u16(YmUInt16(_call->count()));
+        for (const auto& param : _call->params) {
+            w.u8(YmUInt8(param.category));
+            w.str(param.name);
+            w.u32(YmUInt32(param.typeConst));
+        }
+        w.u8(YmUInt8(_call->definingNamed));
+    }
+    w.u8(YmUInt8(_var != nullptr));
+    if (_var) {
+        w.u8(YmUInt8(_var->initializerConst.has_value()));
+        w.u32(YmUInt32(_var->initializerConst.value_or(0)));
+    }
+}
+
+bool _ym::TypeInfo::read(ImageReader& r, const CallBhvrRelinker& relink, std::string_view msg) {
+    bool ok = true;
+    // Reads the index of a ref. const, which is only checked if present.
+    auto index = [&](bool present = true) -> ConstIndex {
+        const ConstIndex result = r.u32();
+        ok = ok && (!present || (result < consts.size() && consts.isRef(result)));
+        return result;
+        };
+    slots = r.u16();
+    // The consts pulled upon our construction (ie. $Self) will have been pulled upon that of
+    // the type written too, and so will prefix those read.
+    const auto pulled = std::exchange(consts, ConstTableInfo{});
+    const size_t constsN = r.u32();
+    for (size_t i = 0; i < constsN && ok && r.good(); i++) {
+        auto c = readConst(r);
+        ok = c.has_value();
+        if (ok) {
+            consts.push(std::move(*c));
+        }
+    }
+    for (ConstIndex i = 0; i < pulled.size() && ok; i++) {
+        ok = i < consts.size() && consts[i] == pulled[i];
+    }
+    const size_t refsN = r.u32();
+    for (size_t i = 0; i < refsN && ok && r.good(); i++) {
+        refs.push_back(index());
+    }
+    const size_t typeParamsN = r.u16();
+    ok = ok && (typeParamsN == 0 || _typeParams);
+    for (size_t i = 0; i < typeParamsN && ok && r.good(); i++) {
+        const auto name = std::string(r.str());
+        const auto constraintConst = index();
+        // Names are checked like ParcelInfo::addTypeParam does (members are read after us, and so
+        // needn't be checked for conflicts.)
+        ok =
+            ok &&
+            r.good() &&
+            isLegalName(name) &&
+            name != "Self" &&
+            !_typeParams->byName(name) &&
+            _typeParams->add(name, constraintConst);
+    }
+    const bool hasCall = r.u8();
+    ok = ok && hasCall == hasCallSig();
+    if (hasCall && ok && r.good()) {
+        const auto id = CallBhvrId(r.u8());
+        CallBhvrCallbackInfo callBehaviour{};
+        if (id == CallBhvrId::NonBuiltin) {
+            if (auto relinked = relink(*this)) {
+                callBehaviour = *relinked;
+            }
+            else {
+                Global::raiseErr(
+                    YmErrCode_ImageError,
+                    "{}; cannot relink call behaviour of {}!",
+                    (std::string)msg,
+                    localName());
+                return false;
+            }
+        }
+        else if (id != CallBhvrId::Inert) {
+            callBehaviour = CallBhvrCallbackInfo::mk(builtinCallBhvr(id), (void*)std::uintptr_t(r.u64()));
+            ok = callBehaviour.fn != nullptr;
+        }
+        const bool hasAssigner = r.u8();
+        const auto assignerConst = index(hasAssigner);
+        const auto returnTypeConst = index();
+        setupCall(
+            callBehaviour,
+            hasAssigner ? std::make_optional(assignerConst) : std::nullopt,
+            returnTypeConst);
+        const size_t paramsN = r.u16();
+        for (size_t i = 0; i < paramsN && ok && r.good(); i++) {
+            const auto category = YmParamCategory(r.u8());
+            const auto name = std::string(r.str());
+            const auto typeConst = index();
+            if (category == YmParamCategory_Named) {
+                _call->beginNamedParams();
+            }
+            // Names are checked like ParcelInfo::addParam does.
+            ok =
+                ok &&
+                r.good() &&
+                (category == YmParamCategory_Positional || category == YmParamCategory_Named) &&
+                isLegalName(name) &&
+                !_call->param(name) &&
+                _call->addParam(name, typeConst);
+        }
+        if (r.u8()) {
+            _call->beginNamedParams();
+        }
+    }
+    if (r.u8() && ok) {
+        const bool hasInitializer = r.u8();
+        const auto initializerConst = index(hasInitializer);
+        setupVar(hasInitializer ? std::make_optional(initializerConst) : std::nullopt);
+    }
+    return
+        ok && r.good()
+        ? true
+        : raiseMalformed(msg);
+}
+
 void _ym::TypeInfo::_initMembership() {
     if (isMember()) {
         auto ownerName = _extractOwnerName(localName());
@@ -623,7 +886,7 @@ const _ym::TypeInfo::TypeParam* _ym::TypeInfo::_TypeParams::byIndex(size_t index
         : nullptr;
 }
 
-const _ym::TypeInfo::TypeParam* _ym::TypeInfo::_TypeParams::byName(const std::string& name) const noexcept {
+const _ym::TypeInfo::TypeParam* _ym::TypeInfo::_TypeParams::byName(std::string_view name) const noexcept {
     auto it = typeParamsByName.find(name);
     return
         it != typeParamsByName.end()
@@ -648,7 +911,7 @@ bool _ym::TypeInfo::_TypeParams::add(const std::string& name, ConstIndex constra
         .name = name,
         .constraintConst = constraintConst,
         }));
-    typeParamsByName.try_emplace(name, ym::Safe(typeParamsByIndex.back().get()));
+    typeParamsByName.try_emplace(typeParamsByIndex.back()->name, ym::Safe(typeParamsByIndex.back().get()));
     return true;
 }
 
@@ -663,7 +926,7 @@ const _ym::TypeInfo::Member* _ym::TypeInfo::_Members::byIndex(size_t index) cons
         : nullptr;
 }
 
-const _ym::TypeInfo::Member* _ym::TypeInfo::_Members::byName(const std::string& name) const noexcept {
+const _ym::TypeInfo::Member* _ym::TypeInfo::_Members::byName(std::string_view name) const noexcept {
     auto it = membersByName.find(name);
     return
         it != membersByName.end()
@@ -683,7 +946,7 @@ void _ym::TypeInfo::_Members::registerMember(TypeInfo& owner, const std::string&
         // Using $Self::[MEMBER] here nicely accounts for things like generics.
         .typeConst = owner.consts.pullRef(Spec::typeFast(std::format("$Self::{}", name))).value(),
         }));
-    membersByName.try_emplace(name, ym::Safe(membersByIndex.back().get()));
+    membersByName.try_emplace(membersByIndex.back()->name, ym::Safe(membersByIndex.back().get()));
 }
 
 YmParams _ym::TypeInfo::_Call::count() const noexcept {
@@ -758,6 +1021,8 @@ void _ym::TypeInfo::_Call::beginNamedParams() noexcept {
 }
 
 bool _ym::ParcelInfo::verify() const {
+    // NOTE: Types are checked as they're added, so there are no per-type checks here yet,
+    //       and so nothing worth caching the result of between binds.
     bool success = true;
     for (const auto& type : _types) {
         continue; // TODO: Add verif. checks when needed.
@@ -770,7 +1035,7 @@ size_t _ym::ParcelInfo::types() const noexcept {
     return _types.size();
 }
 
-_ym::TypeInfo* _ym::ParcelInfo::type(const std::string& localName) noexcept {
+_ym::TypeInfo* _ym::ParcelInfo::type(std::string_view localName) noexcept {
     const auto it = _lookup.find(localName);
     return
         it != _lookup.end()
@@ -778,7 +1043,7 @@ _ym::TypeInfo* _ym::ParcelInfo::type(const std::string& localName) noexcept {
         : nullptr;
 }
 
-const _ym::TypeInfo* _ym::ParcelInfo::type(const std::string& localName) const noexcept {
+const _ym::TypeInfo* _ym::ParcelInfo::type(std::string_view localName) const noexcept {
     const auto it = _lookup.find(localName);
     return
         it != _lookup.end()
@@ -786,6 +1051,11 @@ const _ym::TypeInfo* _ym::ParcelInfo::type(const std::string& localName) const n
         : nullptr;
 }
 
+void _ym::ParcelInfo::reserve(size_t n) {
+    _types.reserve(n);
+    _lookup.reserve(n);
+}
+
 bool _ym::ParcelInfo::addType(
     KindEx k,
     const std::string& localName,
@@ -885,14 +1155,15 @@ std::optional<YmParamIndex> _ym::ParcelInfo::addParam(
     return std::nullopt;
 }
 
-void _ym::ParcelInfo::beginNamedParams(
+bool _ym::ParcelInfo::beginNamedParams(
     const std::string& typeName) {
     if (auto info = _expectType(typeName, "Cannot begin named params")) {
         if (!_checkIsntPropertyOrAssigner(*info, "Cannot begin named params")) {
-            return;
+            return false;
         }
-        info->beginNamedParams();
+        return info->beginNamedParams();
     }
+    return false;
 }
 
 std::optional<YmRef> _ym::ParcelInfo::addRef(
@@ -905,6 +1176,67 @@ std::optional<YmRef> _ym::ParcelInfo::addRef(
         : std::nullopt;
 }
 
+void _ym::ParcelInfo::write(ImageWriter& w) const {
+    w.u32(YmUInt32(types()));
+    for (const auto& type : _types) {
+        type->write(w);
+    }
+}
+
+std::shared_ptr<_ym::ParcelInfo> _ym::ParcelInfo::read(ImageReader& r, const CallBhvrRelinker& relink, std::string_view msg) {
+    auto result = std::make_shared<ParcelInfo>();
+    const size_t n = r.u32();
+    for (size_t i = 0; i < n; i++) {
+        const auto k = KindEx(r.u8());
+        const auto localName = std::string(r.str());
+        // Types are written in the order they were added, so owners/vars/properties will have been
+        // read ahead of their members/assigners.
+        // Local names are checked like the add* methods check them, w/ assigners (whose names are
+        // generated from those of their vars/properties) instead being checked to follow from them.
+        auto legalLocalName = [&]() -> bool {
+            if (kindOf(k) == YmKind_VarAssigner) {
+                const auto [var, suffix] = split_s<YmChar>(localName, "$assigner", true);
+                return suffix == "$assigner" && result->type(var);
+            }
+            if (!ymKind_IsMember(kindOf(k))) {
+                return isLegalName(localName);
+            }
+            const auto [ownerName, memberName] = split_s<YmChar>(localName, "::");
+            const auto owner = result->type(ownerName);
+            if (!owner || !owner->canHaveMembers()) {
+                return false;
+            }
+            if (kindOf(k) == YmKind_PropertyAssigner) {
+                const auto [property, suffix] = split_s<YmChar>(memberName, "$assigner", true);
+                return suffix == "$assigner" && result->type(std::format("{}::{}", ownerName, property));
+            }
+            return
+                isLegalName(memberName) &&
+                memberName != "Self" &&
+                !owner->typeParam(memberName);
+            };
+        const bool wellFormed =
+            r.good() &&
+            size_t(k) < KindExSize &&
+            !result->type(localName) &&
+            legalLocalName();
+        if (!wellFormed) {
+            raiseMalformed(msg);
+            return nullptr;
+        }
+        TypeInfo t(*result, k, localName);
+        if (!t.read(r, relink, msg)) {
+            return nullptr;
+        }
+        result->_registerType(std::move(t));
+    }
+    if (!r.good()) {
+        raiseMalformed(msg);
+        return nullptr;
+    }
+    return result;
+}
+
 _ym::TypeInfo* _ym::ParcelInfo::_expectType(
     const std::string& typeName,
     std::string_view msg) {
@@ -922,43 +1254,14 @@ _ym::TypeInfo* _ym::ParcelInfo::_expectType(
 bool _ym::ParcelInfo::_checkNameLegality(
     const std::string& name,
     std::string_view msg) {
-    auto err = [&]() {
+    if (!isLegalName(name)) {
         Global::raiseErr(
             YmErrCode_IllegalName,
             "{}; name \"{}\" is illegal!",
             (std::string)msg,
             name);
-        };
-    if (name.empty()) {
-        err();
         return false;
     }
-    bool first = true; // If we're at first char (ie. it cannot be a digit.)
-    for (taul::decoder<char> d(taul::utf8, name); !d.done();) {
-        if (auto dr = d.next()) {
-            if (!taul::is_unicode(dr->cp)) {
-                err();
-                return false;
-            }
-            if (!taul::in_codepoint_range(dr->cp, U'a', U'z') &&
-                !taul::in_codepoint_range(dr->cp, U'A', U'Z') &&
-                !taul::in_codepoint_range(dr->cp, U'0', U'9') &&
-                dr->cp != U'_' &&
-                taul::is_ascii(dr->cp)) {
-                err();
-                return false;
-            }
-            if (first && taul::in_codepoint_range(dr->cp, U'0', U'9')) {
-                err();
-                return false;
-            }
-        }
-        else {
-            err();
-            return false;
-        }
-        first = false;
-    }
     return true;
 }
 
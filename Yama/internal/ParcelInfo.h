@@ -3,8 +3,11 @@
 #pragma once
 
 
+#include <functional>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -15,6 +18,8 @@
 
 #include "kinds.h"
 #include "ConstTableInfo.h"
+#include "Image.h"
+#include "InternPool.h"
 #include "SpecSolver.h"
 
 
@@ -26,6 +31,8 @@ namespace _ym {
 
 
     std::optional<Spec> normalizeRefSym(const std::string& symbol, std::string_view msg, SpecSolver solver = {});
+    // Returns if name is legal as a type, member, param or type param name.
+    bool isLegalName(std::string_view name);
     bool checkHasCallSig(const TypeInfo& type, std::string_view msg);
     bool checkNonMember(const TypeInfo& type, std::string_view msg);
     bool checkNonProtocolMember(const TypeInfo& type, std::string_view msg);
@@ -36,24 +43,28 @@ namespace _ym {
     void storedVarGetCallBhvr(YmCtx* ctx, YmType* type, void* user);
     void storedVarSetCallBhvr(YmCtx* ctx, YmType* type, void* user);
 
+    // Relinks the (non-builtin) call behaviour of type, when reading it from an image, returning
+    // std::nullopt if unsuccessful.
+    using CallBhvrRelinker = std::function<std::optional<CallBhvrCallbackInfo>(const TypeInfo& type)>;
+
 
     class TypeInfo final {
     public:
         struct TypeParam final {
             YmTypeParamIndex index;
-            std::string name;
+            IStr name;
             ConstIndex constraintConst;
         };
         struct Member final {
             YmMemberIndex index;
-            std::string name;
+            IStr name;
             ym::Safe<TypeInfo> type;
             ConstIndex typeConst;
         };
         struct Param final {
             YmParamCategory category;
             YmParamIndex index;
-            std::string name;
+            IStr name;
             ConstIndex typeConst;
 
 
@@ -141,11 +152,11 @@ namespace _ym {
         YmTypeParams typeParams() const noexcept;
         bool isParameterized() const noexcept;
         const TypeParam* typeParam(ConstIndex index) const noexcept;
-        const TypeParam* typeParam(const std::string& name) const noexcept;
+        const TypeParam* typeParam(std::string_view name) const noexcept;
 
         YmMembers members() const noexcept;
         const Member* member(ConstIndex index) const noexcept;
-        const Member* member(const std::string& name) const noexcept;
+        const Member* member(std::string_view name) const noexcept;
 
         // NOTE: Remember, since it's possible for a self param to be specified by multiple different
         //       symbols (ie. not just $Self), and which symbols do/don't CAN CHANGE BASED ON THE
@@ -173,7 +184,7 @@ namespace _ym {
 
         std::optional<YmTypeParamIndex> addTypeParam(std::string name, std::string constraintTypeSymbol);
         std::optional<YmParamIndex> addParam(std::string name, std::string paramTypeSymbol, bool skipHasCallSigCheck = false);
-        void beginNamedParams();
+        bool beginNamedParams();
         std::optional<YmRef> addRef(std::string symbol);
 
         void registerMember(const std::string& name);
@@ -191,32 +202,38 @@ namespace _ym {
 
         std::string fullnameForRef() const;
 
+        // Writes *this to w (see ParcelInfo::write.)
+        void write(ImageWriter& w) const;
+        // Reads the rest of what write wrote into *this, which must be freshly constructed w/
+        // the kind/local name read ahead of it (by ParcelInfo::read), returning if successful.
+        bool read(ImageReader& r, const CallBhvrRelinker& relink, std::string_view msg);
+
 
     private:
         struct _Membership final {
-            std::string ownerName, memberName;
+            IStr ownerName, memberName;
             ym::Safe<TypeInfo> owner;
             ConstIndex ownerConst;
         };
         struct _TypeParams final {
             std::vector<std::unique_ptr<const TypeParam>> typeParamsByIndex;
-            std::unordered_map<std::string, ym::Safe<const TypeParam>> typeParamsByName;
+            std::unordered_map<IStr, ym::Safe<const TypeParam>> typeParamsByName;
 
 
             YmTypeParams count() const noexcept;
             const TypeParam* byIndex(size_t index) const noexcept;
-            const TypeParam* byName(const std::string& name) const noexcept;
+            const TypeParam* byName(std::string_view name) const noexcept;
 
             bool add(const std::string& name, ConstIndex constraintConst);
         };
         struct _Members final {
             std::vector<std::unique_ptr<const Member>> membersByIndex;
-            std::unordered_map<std::string, ym::Safe<const Member>> membersByName;
+            std::unordered_map<IStr, ym::Safe<const Member>> membersByName;
 
 
             YmMembers count() const noexcept;
             const Member* byIndex(size_t index) const noexcept;
-            const Member* byName(const std::string& name) const noexcept;
+            const Member* byName(std::string_view name) const noexcept;
 
             // Fails quietly if already registered.
             void registerMember(TypeInfo& owner, const std::string& name);
@@ -249,7 +266,7 @@ namespace _ym {
 
         ParcelInfo* _parcel;
         KindEx _k;
-        std::string _localName;
+        IStr _localName;
         std::unique_ptr<_Membership> _membership;
         std::unique_ptr<_TypeParams> _typeParams;
         std::unique_ptr<_Members> _members;
@@ -276,8 +293,10 @@ namespace _ym {
         bool verify() const;
 
         size_t types() const noexcept;
-        TypeInfo* type(const std::string& localName) noexcept;
-        const TypeInfo* type(const std::string& localName) const noexcept;
+        TypeInfo* type(std::string_view localName) noexcept;
+        // Reserves space for n types in total.
+        void reserve(size_t n);
+        const TypeInfo* type(std::string_view localName) const noexcept;
 
         // Fails if name conflict arises.
         // Invalidates type pointers.
@@ -331,16 +350,24 @@ namespace _ym {
             std::string name,
             std::string paramTypeSymbol,
             bool skipCallSigChecks = false);
-        void beginNamedParams(
+        bool beginNamedParams(
             const std::string& typeName);
         std::optional<YmRef> addRef(
             std::string typeName,
             std::string symbol);
 
+        // Writes *this to w, such that read can rebuild it w/out re-normalizing symbols.
+        void write(ImageWriter& w) const;
+        // Reads a parcel written by write from r, returning nullptr if unsuccessful.
+        // Call behaviours which aren't builtin are relinked via relink.
+        // Specifiers and names are checked like the add* methods check them, so corrupted images
+        // fail to be read, but other corruption (ie. of scalar consts) goes undetected.
+        static std::shared_ptr<ParcelInfo> read(ImageReader& r, const CallBhvrRelinker& relink, std::string_view msg);
+
 
     private:
         std::vector<std::unique_ptr<TypeInfo>> _types;
-        std::unordered_map<std::string, size_t> _lookup;
+        std::unordered_map<IStr, size_t> _lookup;
 
 
         _ym::TypeInfo* _expectType(const std::string& typeName, std::string_view msg);
@@ -11,6 +11,13 @@ std::shared_ptr<YmParcel> _ym::PathBindings::get(const Spec& path) const {
     return nullptr;
 }
 
+std::shared_ptr<YmParcel> _ym::PathBindings::get(std::string_view path) const {
+    if (auto it = _bindings.find(path); it != _bindings.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
 void _ym::PathBindings::set(const Spec& path, std::shared_ptr<YmParcel> x) {
     ymAssert(x != nullptr);
     _bindings[path] = std::move(x); // Overwrite existing, if any.
@@ -4,6 +4,7 @@
 
 
 #include <memory>
+#include <string_view>
 #include <unordered_map>
 
 #include "YmParcel.h"
@@ -19,9 +20,15 @@ namespace _ym {
 
 
 		std::shared_ptr<YmParcel> get(const Spec& path) const;
+		// Like the above, but w/out needing path to be interned. path must be normalized.
+		std::shared_ptr<YmParcel> get(std::string_view path) const;
 		void set(const Spec& path, std::shared_ptr<YmParcel> x);
 		void reset() noexcept;
 
+		// Iterates over (path, parcel) pairs, in no particular order.
+		inline auto begin() const noexcept { return _bindings.cbegin(); }
+		inline auto end() const noexcept { return _bindings.cend(); }
+
 
 	private:
 		std::unordered_map<Spec, std::shared_ptr<YmParcel>> _bindings;
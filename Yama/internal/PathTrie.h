@@ -0,0 +1,121 @@
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <taul/hashing.h>
+
+
+namespace _ym {
+
+
+	// Trie mapping paths, by their '/' delimited segments, to values.
+	// Lookups find the value of the longest (ie. most specific) path which is a prefix of the path
+	// looked up (w/ prefixes being of whole segments), in time proportional to the number of segments
+	// of the path looked up, w/out allocating.
+	template<typename T>
+	class PathTrie final {
+	public:
+		struct Match final {
+			const T* value = nullptr; // nullptr if no prefix of the path has a value.
+			size_t length = 0; // Length (in chars) of the prefix of the path which matched.
+		};
+
+
+		PathTrie() = default;
+
+
+		// Returns the number of paths w/ values.
+		inline size_t size() const noexcept { return _size; }
+
+		// Sets value at path, overwriting any existing one.
+		inline void set(std::string_view path, T value) {
+			_Node* node = &_root;
+			_forEachSegment(path, [&](std::string_view segment, size_t) -> bool {
+				auto it = node->children.find(segment);
+				if (it == node->children.end()) {
+					it = node->children.try_emplace(std::string(segment), std::make_unique<_Node>()).first;
+				}
+				node = it->second.get();
+				return true;
+				});
+			if (!node->value) {
+				_size++;
+			}
+			node->value = std::move(value);
+		}
+
+		// Returns value of the longest path which is a prefix of path.
+		inline Match match(std::string_view path) const noexcept {
+			Match result{};
+			const _Node* node = &_root;
+			_forEachSegment(path, [&](std::string_view segment, size_t end) -> bool {
+				const auto it = node->children.find(segment);
+				if (it == node->children.end()) {
+					return false;
+				}
+				node = it->second.get();
+				if (node->value) {
+					result = Match{ .value = &*node->value, .length = end };
+				}
+				return true;
+				});
+			return result;
+		}
+
+		// Calls f(value) for the values of each path which is a prefix of path, from shortest to longest.
+		inline void forEachPrefix(std::string_view path, auto&& f) const {
+			const _Node* node = &_root;
+			_forEachSegment(path, [&](std::string_view segment, size_t) -> bool {
+				const auto it = node->children.find(segment);
+				if (it == node->children.end()) {
+					return false;
+				}
+				node = it->second.get();
+				if (node->value) {
+					f(std::as_const(*node->value));
+				}
+				return true;
+				});
+		}
+
+
+	private:
+		struct _Hash final {
+			using is_transparent = void;
+			inline size_t operator()(std::string_view x) const noexcept { return taul::hash(x); }
+		};
+
+		struct _Node final {
+			std::unordered_map<std::string, std::unique_ptr<_Node>, _Hash, std::equal_to<>> children;
+			std::optional<T> value;
+		};
+
+
+		_Node _root;
+		size_t _size = 0;
+
+
+		// Calls f(segment, end) for each segment of path, where end is the index one past the end of
+		// the segment, stopping early if f returns false.
+		static inline void _forEachSegment(std::string_view path, auto&& f) {
+			size_t start = 0;
+			while (start <= path.size()) {
+				const size_t end = std::min(path.find('/', start), path.size());
+				if (!f(path.substr(start, end - start), end)) {
+					return;
+				}
+				start = end + 1;
+			}
+		}
+	};
+}
+
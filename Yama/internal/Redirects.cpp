@@ -2,6 +2,8 @@
 
 #include "Redirects.h"
 
+#include <vector>
+
 #include "general.h"
 #include "SpecSolver.h"
 
@@ -13,42 +15,22 @@
 #endif
 
 
-_ym::Spec _ym::RedirectSet::resolve(const Spec& path) const {
-    // NOTE: _redirects being sorted in ascending order ensures that given two entries, one of which is
-    //       a subpath of the other, the subpath one is guaranteed to always appear before the other.
-    // 
-    //       Example:
-    //          x
-    //          x/y
-    //          x/y/z
-    //          abc
-    //          abc/def
-    // 
-    //       This means that by iterating backwards, we'll always encounter the more specific path of
-    //       the two first, letting us easily impl shadowing.
+bool _ym::RedirectSet::resolve(std::string& path) const {
 #if _DUMP_LOG
     ym::println("RedirectSet::resolve: Resolving {} ({} redirects to check).", path, _redirects.size());
 #endif
-    auto s = path.string();
-    for (auto it = _redirects.rbegin(); it != _redirects.rend(); std::advance(it, 1)) {
-        auto& [before, after] = *it;
-#if _DUMP_LOG
-        ym::println("RedirectSet::resolve: {} -> {}", before, after);
-#endif
-        if (path.string().starts_with(before.string())) {
+    const auto match = _redirects.match(path);
+    if (!match.value) {
 #if _DUMP_LOG
-            ym::println("RedirectSet::resolve: Match!");
+        ym::println("RedirectSet::resolve: No match.");
 #endif
-            // Redirect found, so modify path, and exit loop as we found the correct redirect.
-            s.replace(0, before.string().length(), after.string());
-            break;
-        }
+        return false;
     }
+    path.replace(0, match.length, match.value->string());
 #if _DUMP_LOG
-    ym::println("RedirectSet::resolve: Result: {}", s);
+    ym::println("RedirectSet::resolve: Result: {}", path);
 #endif
-    // Return result path, whether we found a redirect for it or not.
-    return Spec::pathFast(std::move(s));
+    return true;
 }
 
 void _ym::Redirects::add(const Spec& subject, const Spec& before, const Spec& after) {
@@ -62,33 +44,50 @@ void _ym::Redirects::add(const Spec& subject, const Spec& before, const Spec& af
         ym::println("RedirectSet::add:     {} / {} -> {}", subject, before, after);
     }
 #endif
+    _compile();
+}
+
+size_t _ym::Redirects::count() const noexcept {
+    return _redirects.size();
 }
 
-_ym::RedirectSet _ym::Redirects::compute(const Spec& path) const {
-    // NOTE: _redirects being sorted in ascending order ensures that given two entries, one of which is
-    //       a subpath of the other, the subpath one is guaranteed to always appear before the other.
-    // 
-    //       Example:
-    //          x
-    //          x/y
-    //          x/y/z
-    //          abc
-    //          abc/def
-    // 
-    //       This means that by having below overwrite existing before/after entries in result, more specific
-    //       subject path before/after entries will shadow those of less specific subject paths.
-    RedirectSet result{};
+std::shared_ptr<const _ym::RedirectSet> _ym::Redirects::compute(const Spec& path) const {
+    const auto match = _compiled.match(path.string());
+    return
+        match.value
+        ? *match.value
+        : nullptr;
+}
+
+void _ym::Redirects::_compile() {
+    // Group before/after entries by subject (w/ _redirects being sorted, entries of a subject are adjacent.)
+    using Entries = std::vector<std::pair<Spec, Spec>>;
+    std::vector<std::pair<Spec, Entries>> groups{};
     for (const auto& [subjectAndBefore, after] : _redirects) {
         const auto& [subject, before] = subjectAndBefore;
-        if (path.string().starts_with(subject.string())) {
-            result._redirects.insert_or_assign(before, after);
+        if (groups.empty() || groups.back().first != subject) {
+            groups.push_back({ subject, {} });
         }
+        groups.back().second.push_back({ before, after });
     }
-#if _DUMP_LOG
-    ym::println("Redirects::compute: Printing redirects (path={}):", path);
-    for (const auto& [before, after] : result._redirects) {
-        ym::println("Redirects::compute:     {} -> {}", before, after);
+    PathTrie<const Entries*> bySubject{};
+    for (const auto& [subject, entries] : groups) {
+        bySubject.set(subject.string(), &entries);
     }
+    PathTrie<std::shared_ptr<const RedirectSet>> compiled{};
+    for (const auto& [subject, entries] : groups) {
+        // NOTE: forEachPrefix goes from least to most specific subject, so below having more specific
+        //       subjects overwrite entries of less specific ones impls shadowing.
+        auto result = std::make_shared<RedirectSet>();
+        bySubject.forEachPrefix(subject.string(), [&](const Entries* prefixEntries) {
+            for (const auto& [before, after] : *prefixEntries) {
+                result->_redirects.set(before.string(), after);
+            }
+            });
+#if _DUMP_LOG
+        ym::println("Redirects::_compile: Compiled redirects (subject={}, {} redirects).", subject, result->_redirects.size());
 #endif
-    return result;
+        compiled.set(subject.string(), std::move(result));
+    }
+    _compiled = std::move(compiled);
 }
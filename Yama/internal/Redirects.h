@@ -3,31 +3,35 @@
 #pragma once
 
 
-#include <string>
+#include <concepts>
 #include <map>
+#include <memory>
+#include <string>
 
+#include "PathTrie.h"
 #include "Spec.h"
 
 
 namespace _ym {
 
 
-	// NOTE: The usage of std::map here is due to how it will ensure that our map keys are sorted in
-	//		 ascending order. This is important for both RedirectSet::resolve and Redirects::compute,
-	//		 as it makes it easy to impl all redirect shadowing semantics.
+	// NOTE: Redirects are compiled into path-segment tries (see PathTrie), such that resolving a path
+	//		 costs time proportional to its number of segments, rather than to the number of redirects.
+	//		 Tries find the longest matching prefix, which impls all redirect shadowing semantics.
 
 	class RedirectSet final {
 	public:
 		RedirectSet() = default;
 		~RedirectSet() noexcept = default;
-		RedirectSet(const RedirectSet&) = default;
+		RedirectSet(const RedirectSet&) = delete;
 		RedirectSet(RedirectSet&&) noexcept = default;
-		RedirectSet& operator=(const RedirectSet&) = default;
+		RedirectSet& operator=(const RedirectSet&) = delete;
 		RedirectSet& operator=(RedirectSet&&) noexcept = default;
 
 
-		// Returns path modified by the appropriate redirect, or unmodified is no redirect for it was found.
-		Spec resolve(const Spec& path) const;
+		// Modifies path via the appropriate redirect, returning if a redirect for it was found.
+		// Doesn't allocate unless path is modified.
+		bool resolve(std::string& path) const;
 
 
 	private:
@@ -35,7 +39,7 @@ namespace _ym {
 
 
 		// Maps 'before' paths to 'after' paths.
-		std::map<Spec, Spec> _redirects;
+		PathTrie<Spec> _redirects;
 	};
 
 	class Redirects final {
@@ -45,13 +49,32 @@ namespace _ym {
 
 		void add(const Spec& subject, const Spec& before, const Spec& after);
 
-		// Computes the redirect set for path.
-		RedirectSet compute(const Spec& path) const;
+		size_t count() const noexcept;
+		// Invokes f as f(subject, before, after) for each redirect added.
+		template<std::invocable<const Spec&, const Spec&, const Spec&> F>
+		inline void forEach(F&& f) const {
+			for (const auto& [subjectAndBefore, after] : _redirects) {
+				f(subjectAndBefore.first, subjectAndBefore.second, after);
+			}
+		}
+
+		// Returns the redirect set for path, or nullptr if no redirects apply to it.
+		// Redirect sets are shared by all paths w/ the same most specific subject, and are never
+		// mutated, so they may be held onto after further redirects are added.
+		std::shared_ptr<const RedirectSet> compute(const Spec& path) const;
 
 
 	private:
 		// Maps pair of 'subject' and 'before' paths to 'after' paths.
 		std::map<std::pair<Spec, Spec>, Spec> _redirects;
+
+		// Maps 'subject' paths to redirect sets, w/ each set including the redirects of less specific
+		// subjects (which the set's own redirects shadow.)
+		// Rebuilt upon each add.
+		PathTrie<std::shared_ptr<const RedirectSet>> _compiled;
+
+
+		void _compile();
 	};
 }
 
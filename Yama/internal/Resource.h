@@ -14,7 +14,28 @@ namespace _ym {
         requires (const std::remove_cvref_t<T> v)
     {
         typename T::Name;
-        { v.getName() } noexcept -> std::convertible_to<const typename T::Name&>;
+        // Not required to be noexcept, as names may be generated lazily.
+        { v.getName() } -> std::convertible_to<const typename T::Name&>;
+    };
+
+    // Resources which, in addition to their name, have a structural id w/ which they can be
+    // looked up more cheaply than by name.
+    template<typename T>
+    concept IdentifiedResource =
+        Resource<T> &&
+        requires (const std::remove_cvref_t<T> v)
+    {
+        typename T::Id;
+        { v.getId() } noexcept -> std::convertible_to<const typename T::Id&>;
     };
-}
 
+    // Resources which can enumerate the resources they depend upon, via a visitor invoked
+    // for each, allowing for reachability analysis.
+    template<typename T>
+    concept TraversableResource =
+        Resource<T> &&
+        requires (const std::remove_cvref_t<T> v)
+    {
+        v.visitDeps([](const std::remove_cvref_t<T>&) {});
+    };
+}
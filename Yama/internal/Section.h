@@ -3,10 +3,14 @@
 #pragma once
 
 
+#include <algorithm>
 #include <memory>
 #include <ranges>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "../yama++/general.h"
 #include "../yama++/Safe.h"
@@ -16,6 +20,34 @@
 namespace _ym {
 
 
+    namespace _section {
+        struct NoIdMap final {};
+
+        // Ids are keyed by pointer to the id owned by the resource, avoiding copying them.
+        template<typename Id>
+        struct IdPtrHash final {
+            using is_transparent = void;
+            inline size_t operator()(const Id* x) const noexcept { return std::hash<Id>{}(*x); }
+            inline size_t operator()(const Id& x) const noexcept { return std::hash<Id>{}(x); }
+        };
+        template<typename Id>
+        struct IdPtrEq final {
+            using is_transparent = void;
+            inline bool operator()(const Id* lhs, const Id* rhs) const noexcept { return *lhs == *rhs; }
+            inline bool operator()(const Id* lhs, const Id& rhs) const noexcept { return *lhs == rhs; }
+            inline bool operator()(const Id& lhs, const Id* rhs) const noexcept { return lhs == *rhs; }
+        };
+
+        template<Resource T>
+        struct IdMapOf final {
+            using Type = NoIdMap;
+        };
+        template<IdentifiedResource T>
+        struct IdMapOf<T> final {
+            using Type = std::unordered_map<const typename T::Id*, std::shared_ptr<T>, IdPtrHash<typename T::Id>, IdPtrEq<typename T::Id>>;
+        };
+    }
+
     template<Resource T>
     class Section final {
     public:
@@ -24,6 +56,10 @@ namespace _ym {
 
     private:
         using _NameMapT = std::unordered_map<Name, std::shared_ptr<T>>;
+        using _IdMapT = _section::IdMapOf<T>::Type;
+        // For identified resources, the id map is the one containing all resources (as some may
+        // be nameless), and so is what's used for traversal.
+        using _StoreT = std::conditional_t<IdentifiedResource<T>, _IdMapT, _NameMapT>;
 
 
     public:
@@ -36,7 +72,7 @@ namespace _ym {
             using iterator_category = std::forward_iterator_tag;
 
 
-            inline Iterator(_NameMapT::const_iterator it, _NameMapT::const_iterator end) :
+            inline Iterator(_StoreT::const_iterator it, _StoreT::const_iterator end) :
                 _it(it),
                 _end(end) {}
 
@@ -77,7 +113,7 @@ namespace _ym {
 
 
         private:
-            _NameMapT::const_iterator _it, _end;
+            _StoreT::const_iterator _it, _end;
         };
 
         using View = std::ranges::subrange<Iterator>;
@@ -87,11 +123,11 @@ namespace _ym {
 
 
         // Traversal doesn't acknowledge upstream resources.
-        inline Iterator begin() const noexcept { return Iterator(_byName.begin(), _byName.end()); }
+        inline Iterator begin() const noexcept { return Iterator(_store().begin(), _store().end()); }
         // Traversal doesn't acknowledge upstream resources.
         inline Iterator cbegin() const noexcept { return begin(); }
         // Traversal doesn't acknowledge upstream resources.
-        inline Iterator end() const noexcept { return Iterator(_byName.end(), _byName.end()); }
+        inline Iterator end() const noexcept { return Iterator(_store().end(), _store().end()); }
         // Traversal doesn't acknowledge upstream resources.
         inline Iterator cend() const noexcept { return end(); }
 
@@ -99,17 +135,29 @@ namespace _ym {
         inline View view() const noexcept { return View(begin(), end()); }
 
         // Traversal doesn't acknowledge upstream resources.
+        // Nameless resources cannot be found this way.
         inline Iterator find(const Name& name) const noexcept {
-            return Iterator(_byName.find(name), _byName.end());
+            if constexpr (IdentifiedResource<T>) {
+                const auto it = _byName.find(name);
+                return
+                    it != _byName.end()
+                    ? Iterator(_byId.find(&it->second->getId()), _byId.end())
+                    : end();
+            }
+            else {
+                return Iterator(_byName.find(name), _byName.end());
+            }
         }
 
+        // Includes nameless resources.
         inline size_t count(bool localOnly = false) const noexcept {
             return
                 _upstream && !localOnly
-                ? _byName.size() + _upstream->count()
-                : _byName.size();
+                ? _store().size() + _upstream->count()
+                : _store().size();
         }
 
+        // Nameless resources cannot be found this way.
         inline bool exists(const Name& name, bool localOnly = false) const noexcept {
             return
                 _upstream && !localOnly
@@ -117,6 +165,7 @@ namespace _ym {
                 : _byName.contains(name);
         }
         
+        // Nameless resources cannot be found this way.
         inline std::shared_ptr<T> fetch(const Name& name, bool localOnly = false) const noexcept {
             if (const auto it = _byName.find(name); it != _byName.end()) {
                 return it->second;
@@ -127,45 +176,220 @@ namespace _ym {
                 : nullptr;
         }
 
+        // Like fetch, but w/ name being of a type which Name can be compared w/ (and hashed like),
+        // such that a Name needn't be constructed for lookup (ie. to avoid interning it.)
+        template<typename K>
+            requires (!std::same_as<std::remove_cvref_t<K>, Name>)
+        inline std::shared_ptr<T> fetch(const K& name, bool localOnly = false) const noexcept {
+            if (const auto it = _byName.find(name); it != _byName.end()) {
+                return it->second;
+            }
+            return
+                _upstream && !localOnly
+                ? _upstream->fetch(name, false)
+                : nullptr;
+        }
+
+        // Like exists, but looks up resource by id rather than name.
+        // Nameless resources can be found this way.
+        template<IdentifiedResource U = T>
+        inline bool existsById(const typename U::Id& id, bool localOnly = false) const noexcept {
+            return
+                _upstream && !localOnly
+                ? _byId.contains(id) || _upstream->existsById(id)
+                : _byId.contains(id);
+        }
+
+        // Like fetch, but looks up resource by id rather than name.
+        // Nameless resources can be fetched this way.
+        template<IdentifiedResource U = T>
+        inline std::shared_ptr<T> fetchById(const typename U::Id& id, bool localOnly = false) const noexcept {
+            if (const auto it = _byId.find(id); it != _byId.end()) {
+                return it->second;
+            }
+            return
+                _upstream && !localOnly
+                ? _upstream->fetchById(id, false)
+                : nullptr;
+        }
+
         // Sets the upstream section, or no upstream section if upstream == nullptr.
         inline void setUpstream(Section* upstream) noexcept {
             _upstream = upstream;
         }
 
-        inline bool push(std::shared_ptr<T> resource) {
+        // If nameless, resource is indexed only by id, not name, w/ resource's name not being queried.
+        // Nameless resources can be indexed by name later via addName.
+        // Only identified resources may be nameless.
+        inline bool push(std::shared_ptr<T> resource, bool nameless = false) {
             if (!resource) return false;
-            const Name& name = resource->getName();
-            if (exists(name)) return false;
-            _byName.try_emplace(name, resource);
+            if constexpr (IdentifiedResource<T>) {
+                if (existsById(resource->getId())) return false;
+                if (!nameless && exists(resource->getName())) return false;
+                _byId.try_emplace(&resource->getId(), resource);
+                if (!nameless) {
+                    _byName.try_emplace(resource->getName(), resource);
+                }
+            }
+            else {
+                ymAssert(!nameless);
+                const Name& name = resource->getName();
+                if (exists(name)) return false;
+                _byName.try_emplace(name, resource);
+            }
+            _track(resource.get());
             return true;
         }
+
+        // Indexes nameless resource (which must be in this section, not upstream) by name.
+        // Fails quietly if resource is already indexed by name.
+        template<IdentifiedResource U = T>
+        inline void addName(const std::shared_ptr<T>& resource) {
+            ymAssert(resource != nullptr);
+            ymAssert(_byId.contains(resource->getId()));
+            if (_byName.try_emplace(resource->getName(), resource).second) {
+                _track(resource.get());
+            }
+        }
         
         // Discards all resources in the section.
         inline void discard(bool propagateUpstream = false) noexcept {
+            _added.clear();
             _byName.clear();
+            if constexpr (IdentifiedResource<T>) {
+                _byId.clear();
+            }
             if (propagateUpstream && _upstream) {
                 _upstream->discard(true);
             }
         }
 
-        // TODO: A cool feature to add would be to given commit/commitOrDiscard an optional
-        //       'root' parameter, then having it be that ONLY resources which are referenced
-        //       directly/indirectly by root are committed, and EVERYTHING ELSE IS DISCARDED!
-        //
-        //       This would let us be *sloppy*, adding items to an section during loading which
-        //       are needed to check things DURING the load, but which aren't depended upon by
-        //       the thing being loaded itself, and so could be discarded.
-        //
-        //       For this we could use a visitor pattern setup akin to what we'd use for a GC.
-        //
-        //       This impl would need to be able to detect, and avoid traversing, items which
-        //       are already upstream, and so 100% don't ref downstream stuff, and so it'd be
-        //       wasteful to scan those.
-        //
-        //       Also, this impl would need to be able to avoid rescanning already traversed
-        //       items. For example, method types and their owner types will need to have a
-        //       dep graph cycle between them so that traversing from either one GUARANTEED
-        //       will visit BOTH, and this graph cycle would need to be handled correctly.
+        // Discards all resources in the section which aren't reachable from root, w/ reachability
+        // being determined by traversing the deps of resources via T::visitDeps.
+        // This lets us be *sloppy*, adding resources to a section during loading which are needed
+        // to check things DURING the load, but which aren't depended upon by root itself.
+        // Upstream resources are not traversed, as they cannot reference downstream ones.
+        // Resources are visited at most once, so dep graph cycles (ie. between owners and their
+        // members) are handled.
+        // If root isn't in this section (ie. it's upstream), then all resources are discarded.
+        template<TraversableResource U = T>
+        inline void prune(const T& root) {
+            std::unordered_set<const T*> reached{};
+            _reach(reached, { &root }, [this](const T& x) { return _isLocal(x); });
+            auto unreached = [&reached](const auto& entry) -> bool {
+                return !reached.contains(entry.second.get());
+                };
+            std::erase_if(_byName, unreached);
+            if constexpr (IdentifiedResource<T>) {
+                std::erase_if(_byId, unreached);
+            }
+        }
+
+        // A resource found unreachable by mark, and thus a candidate for sweep.
+        struct Candidate final {
+            std::shared_ptr<T> resource; // Keeps resource alive until sweep.
+            bool named; // If resource is indexed by name.
+        };
+
+        // A copy of the section's resources (and which of them are roots) for mark to traverse,
+        // such that marking needn't block mutation of the section.
+        struct Snapshot final {
+            std::vector<Candidate> resources;
+            std::vector<const T*> roots;
+        };
+
+        // Takes a snapshot of the section for mark, w/ resources added to the section thereafter
+        // being tracked, so the sweep which follows can keep resources they depend upon.
+        // isRoot is called as isRoot(x, shared), where shared is if x is shared w/ owners other
+        // than this section (ie. if something outside the section holds a std::shared_ptr to it.)
+        // This is read-only (beyond beginning tracking), and so can run concurrently w/ other readers.
+        template<TraversableResource U = T>
+        inline Snapshot snapshot(auto&& isRoot) {
+            std::unordered_set<const T*> named{};
+            for (const auto& [key, value] : _byName) {
+                named.insert(value.get());
+            }
+            Snapshot result{};
+            result.resources.reserve(_store().size());
+            for (const auto& [key, value] : _store()) {
+                const bool isNamed = named.contains(value.get());
+                // Check before copying value, as the copy would make it appear shared.
+                if (isRoot(std::as_const(*value), _isShared(value, isNamed))) {
+                    result.roots.push_back(value.get());
+                }
+                result.resources.push_back(Candidate{ .resource = value, .named = isNamed });
+            }
+            _added.clear();
+            _tracking = true;
+            return result;
+        }
+
+        // Marks all resources in snapshot reachable from its roots, returning those which aren't.
+        // This doesn't access the section, so it may run while the section is being mutated, so
+        // long as the deps of the resources in snapshot don't change (unless thread-safely.)
+        template<TraversableResource U = T>
+        static inline std::vector<Candidate> mark(Snapshot snapshot) {
+            std::unordered_set<const T*> inSnapshot{};
+            for (const auto& c : snapshot.resources) {
+                inSnapshot.insert(c.resource.get());
+            }
+            std::unordered_set<const T*> reached{};
+            _reach(reached, std::move(snapshot.roots), [&](const T& x) { return inSnapshot.contains(&x); });
+            std::erase_if(snapshot.resources, [&](const Candidate& c) { return reached.contains(c.resource.get()); });
+            return std::move(snapshot.resources);
+        }
+
+        // Removes candidates (from mark) from the section, returning them.
+        // Candidates which became roots since snapshot (ie. due to a reader acquiring them), and
+        // candidates which resources added since snapshot depend upon, are kept, alongside candidates
+        // reachable from them, so this only costs time proportional to the number of candidates (and
+        // of resources added), making it suitable for running while readers are paused.
+        // Removed resources are returned so the caller may destroy them outside of any such pause.
+        template<TraversableResource U = T>
+        inline std::vector<std::shared_ptr<T>> sweep(std::vector<Candidate>&& candidates, auto&& isRoot) {
+            // Candidates may have been discarded since snapshot.
+            std::erase_if(candidates, [this](const Candidate& c) { return !_isLocal(*c.resource); });
+            std::unordered_set<const T*> isCandidate{};
+            for (const auto& c : candidates) {
+                isCandidate.insert(c.resource.get());
+            }
+            // Resources which aren't candidates were reached by mark, and so only depend upon
+            // candidates if they were added since, so only traverse candidates.
+            std::vector<const T*> roots{};
+            auto visit = [&](const T& x) {
+                if (isCandidate.contains(&x)) {
+                    roots.push_back(&x);
+                }
+                };
+            for (const T* x : _added) {
+                visit(*x); // In case x is a candidate which was indexed by name.
+                x->visitDeps(visit);
+            }
+            _added.clear();
+            _tracking = false;
+            for (const auto& c : candidates) {
+                if (isRoot(std::as_const(*c.resource), _isShared(c.resource, c.named, 1))) {
+                    roots.push_back(c.resource.get());
+                }
+            }
+            std::unordered_set<const T*> revived{};
+            if (!roots.empty()) {
+                _reach(revived, std::move(roots), [&](const T& x) { return isCandidate.contains(&x); });
+            }
+            std::vector<std::shared_ptr<T>> result{};
+            result.reserve(candidates.size() - std::min(candidates.size(), revived.size()));
+            for (auto& c : candidates) {
+                if (revived.contains(c.resource.get())) continue;
+                if (c.named) {
+                    _byName.erase(c.resource->getName());
+                }
+                if constexpr (IdentifiedResource<T>) {
+                    _byId.erase(&c.resource->getId());
+                }
+                result.push_back(std::move(c.resource));
+            }
+            return result;
+        }
 
         // Transfers the resources from the section to the upstream section.
         // Fails quietly if there is no upstream section.
@@ -179,8 +403,17 @@ namespace _ym {
                     }
                     return true;
                     }());
+                if (_upstream->_tracking) {
+                    for (const auto& [key, value] : _store()) {
+                        _upstream->_added.push_back(value.get());
+                    }
+                }
                 _upstream->_byName.merge(_byName);
                 ymAssert(_byName.empty());
+                if constexpr (IdentifiedResource<T>) {
+                    _upstream->_byId.merge(_byId);
+                    ymAssert(_byId.empty());
+                }
             }
         }
 
@@ -189,10 +422,76 @@ namespace _ym {
             else        discard();
         }
 
+        // Like commitOrDiscard, but committing only resources reachable from root (see prune.)
+        template<TraversableResource U = T>
+        inline void commitReachableOrDiscard(const T* root) {
+            if (root) {
+                prune(*root);
+                commit();
+            }
+            else {
+                discard();
+            }
+        }
+
 
     private:
         Section* _upstream = nullptr;
         std::unordered_map<Name, std::shared_ptr<T>> _byName;
+        [[no_unique_address]] _IdMapT _byId; // Secondary index for identified resources.
+        // Between snapshot and sweep, resources added to the section (or indexed by name) are
+        // tracked, as they may depend upon candidates.
+        bool _tracking = false;
+        std::vector<const T*> _added;
+
+
+        inline const _StoreT& _store() const noexcept {
+            if constexpr (IdentifiedResource<T>) return _byId;
+            else                                 return _byName;
+        }
+
+        inline void _track(const T* x) {
+            if (_tracking) {
+                _added.push_back(x);
+            }
+        }
+
+        // Adds resources reachable from pending to reached, traversing only resources for which
+        // isLocal(x) is true. Resources are visited at most once, so dep graph cycles are handled.
+        template<TraversableResource U = T>
+        static inline void _reach(std::unordered_set<const T*>& reached, std::vector<const T*> pending, auto&& isLocal) {
+            std::erase_if(pending, [&](const T* x) { return !isLocal(*x) || !reached.insert(x).second; });
+            auto visit = [&](const T& x) {
+                if (isLocal(x) && reached.insert(&x).second) {
+                    pending.push_back(&x);
+                }
+                };
+            while (!pending.empty()) {
+                const T* next = pending.back();
+                pending.pop_back();
+                next->visitDeps(visit);
+            }
+        }
+
+        // Returns if local resource x is owned by things other than this section, not counting
+        // heldRefs refs held by the caller.
+        static inline bool _isShared(const std::shared_ptr<T>& x, bool named, long heldRefs = 0) noexcept {
+            // For identified resources, the id map holds one ref, and the name map another if named.
+            const long localRefs = IdentifiedResource<T> && named ? 2 : 1;
+            return x.use_count() > localRefs + heldRefs;
+        }
+
+        // Returns if x is in this section (rather than upstream, or nowhere.)
+        inline bool _isLocal(const T& x) const noexcept {
+            if constexpr (IdentifiedResource<T>) {
+                const auto it = _byId.find(&x.getId());
+                return it != _byId.end() && it->second.get() == &x;
+            }
+            else {
+                const auto it = _byName.find(x.getName());
+                return it != _byName.end() && it->second.get() == &x;
+            }
+        }
     };
 }
 
@@ -51,14 +51,14 @@ std::optional<_ym::Spec> _ym::Spec::either(const std::string& specifier) {
 	return Spec::either(specifier, s);
 }
 
-_ym::Spec _ym::Spec::pathFast(std::string normalizedPath) {
+_ym::Spec _ym::Spec::pathFast(std::string_view normalizedPath) {
 	assertNormal(normalizedPath);
-	return std::move(Spec(std::move(normalizedPath), Type::Path).assertPath());
+	return std::move(Spec(normalizedPath, Type::Path).assertPath());
 }
 
-_ym::Spec _ym::Spec::typeFast(std::string normalizedFullname) {
+_ym::Spec _ym::Spec::typeFast(std::string_view normalizedFullname) {
 	assertNormal(normalizedFullname);
-	return std::move(Spec(std::move(normalizedFullname), Type::Type).assertType());
+	return std::move(Spec(normalizedFullname, Type::Type).assertType());
 }
 
 std::strong_ordering _ym::Spec::operator<=>(const Spec& other) const noexcept {
@@ -66,7 +66,7 @@ std::strong_ordering _ym::Spec::operator<=>(const Spec& other) const noexcept {
 }
 
 const std::string& _ym::Spec::string() const noexcept {
-	return _spec;
+	return _spec.string();
 }
 
 std::string_view _ym::Spec::base() const noexcept {
@@ -120,19 +120,19 @@ const _ym::Spec& _ym::Spec::assertNoCallSuff() const noexcept {
 }
 
 size_t _ym::Spec::hash() const noexcept {
-	return std::hash<Spec>{}(*this);
+	return _spec.hash();
 }
 
 std::string _ym::Spec::fmt() const {
-	return _spec;
+	return _spec.string();
 }
 
 _ym::Spec _ym::Spec::transformed(
-	RedirectSet* redirects,
+	const RedirectSet* redirects,
 	YmParcel* here,
 	YmType* typeParamsCtx,
 	YmType* self) const {
-	return Spec(SpecSolver(here, typeParamsCtx, self, redirects)(_spec).value(), type());
+	return Spec(SpecSolver(here, typeParamsCtx, self, redirects)(string()).value(), type());
 }
 
 _ym::Spec _ym::Spec::removeCallSuff() const {
@@ -142,7 +142,7 @@ _ym::Spec _ym::Spec::removeCallSuff() const {
 		: *this;
 }
 
-_ym::Spec::Spec(std::string s, Type t) :
-	_spec(std::move(s)),
+_ym::Spec::Spec(std::string_view s, Type t) :
+	_spec(s),
 	_type(t) {
 }
@@ -13,6 +13,7 @@
 #include "../yama/yama.h"
 #include "../yama/scalars.h"
 #include "../yama++/macros.h"
+#include "InternPool.h"
 
 
 namespace _ym {
@@ -48,8 +49,8 @@ namespace _ym {
 		static std::optional<Spec> either(const std::string& specifier, SpecSolver& solver);
 		static std::optional<Spec> either(const std::string& specifier);
 
-		static Spec pathFast(std::string normalizedPath);
-		static Spec typeFast(std::string normalizedFullname);
+		static Spec pathFast(std::string_view normalizedPath);
+		static Spec typeFast(std::string_view normalizedFullname);
 
 
 		bool operator==(const Spec&) const noexcept = default;
@@ -83,7 +84,7 @@ namespace _ym {
 		std::string fmt() const;
 
 		Spec transformed(
-			RedirectSet* redirects,
+			const RedirectSet* redirects,
 			YmParcel* here = nullptr,
 			YmType* typeParamsCtx = nullptr,
 			YmType* self = nullptr) const;
@@ -91,11 +92,11 @@ namespace _ym {
 
 
 	private:
-		std::string _spec;
+		IStr _spec; // Interned, so equality/hashing of specifiers is cheap.
 		Type _type;
 
 
-		Spec(std::string s, Type t);
+		Spec(std::string_view s, Type t);
 	};
 }
 
@@ -109,7 +110,7 @@ namespace std {
 	struct hash<_ym::Spec> final {
 		using is_transparent = void;
 		size_t operator()(const _ym::Spec& x) const {
-			return taul::hash((std::string_view)x.string());
+			return x.hash();
 		}
 		size_t operator()(const std::string& x) const {
 			return taul::hash((std::string_view)x);
@@ -136,6 +137,15 @@ namespace std {
 		bool operator()(const _ym::Spec& lhs, const char* rhs) const {
 			return lhs.string() == rhs;
 		}
+		bool operator()(const std::string& lhs, const _ym::Spec& rhs) const {
+			return lhs == rhs.string();
+		}
+		bool operator()(const std::string_view& lhs, const _ym::Spec& rhs) const {
+			return lhs == rhs.string();
+		}
+		bool operator()(const char* lhs, const _ym::Spec& rhs) const {
+			return lhs == rhs.string();
+		}
 	};
 }
 
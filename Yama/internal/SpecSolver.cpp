@@ -3,6 +3,7 @@
 #include "SpecSolver.h"
 
 #include "../yama++/general.h"
+#include "LoadStats.h"
 #include "YmType.h"
 
 
@@ -17,7 +18,7 @@ _ym::SpecSolver::SpecSolver(
     YmParcel* here,
     YmType* typeParamsCtx,
     YmType* self,
-    RedirectSet* redirects) noexcept :
+    const RedirectSet* redirects) noexcept :
     _here(here),
     _typeParamCtx(typeParamsCtx),
     _self(self),
@@ -39,6 +40,7 @@ std::optional<std::string> _ym::SpecSolver::operator()(const SpecParser::Result&
 }
 
 std::optional<std::string> _ym::SpecSolver::operator()(const taul::str& specifier, Type& type, MustBe mustBe) {
+    YM_LOAD_STAT(SpecifiersParsed, 1);
     return operator()(SpecParser{}(specifier), mustBe);
 }
 
@@ -130,8 +132,7 @@ void _ym::SpecSolver::_handleRedirectsIfPath() {
 #if _DUMP_LOG
         auto old = _scope().output;
 #endif
-        // TODO: This conversion into and then out of Spec is suboptimal.
-        _scope().output = _redirects->resolve(Spec::pathFast(_scope().output)).string();
+        _redirects->resolve(_scope().output);
 #if _DUMP_LOG
         if (_scope().output != old) {
             ym::println("SpecSolver: Redirect! {} -> {}", old, _scope().output);
@@ -374,8 +375,8 @@ void _ym::SpecSolver::closeCallSuff() {
     }
 }
 
-void _ym::assertNormal(const std::string& specifier) noexcept {
-    ymAssert(SpecSolver()(specifier).has_value());
+void _ym::assertNormal(std::string_view specifier) noexcept {
+    ymAssert(SpecSolver()(std::string(specifier)).has_value());
 }
 
 bool _ym::specifierHasSelf(const std::string& specifier) {
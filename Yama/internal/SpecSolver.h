@@ -37,7 +37,7 @@ namespace _ym {
             YmParcel* here = nullptr,
             YmType* typeParamsCtx = nullptr,
             YmType* self = nullptr,
-            RedirectSet* redirects = nullptr
+            const RedirectSet* redirects = nullptr
         ) noexcept;
 
 
@@ -62,7 +62,7 @@ namespace _ym {
 
         YmParcel* _here = nullptr;
         YmType* _typeParamCtx = nullptr, * _self = nullptr;
-        RedirectSet* _redirects = nullptr;
+        const RedirectSet* _redirects = nullptr;
 
         // TODO: Maybe use thread-local field to optimize below.
 
@@ -123,7 +123,7 @@ namespace _ym {
 
 
     // ymAssert(s) that specifier is normal.
-    void assertNormal(const std::string& specifier) noexcept;
+    void assertNormal(std::string_view specifier) noexcept;
 
     // Returns if specifier contains $Self anywhere within it.
     bool specifierHasSelf(const std::string& specifier);
@@ -2,6 +2,8 @@
 
 #include "TermStk.h"
 
+#include "LoadStats.h"
+
 
 #define _DUMP_LOG 0
 
@@ -54,14 +56,14 @@ std::span<const _ym::Term> _ym::TermStk::topN(size_t n) const noexcept {
         : std::span<const Term>{};
 }
 
-void _ym::TermStk::beginSession(std::string errPrefix, YmType& type, std::string here, YmType& self) {
+void _ym::TermStk::beginSession(Spec dependency, YmType& type, Spec here, YmType& self) {
 #if _DUMP_LOG
-    ym::println("TermStk: {} {}, {}, {}, {}", __func__, errPrefix, type.fullname(), here, self.fullname());
+    ym::println("TermStk: {} {}, {}, {}, {}", __func__, dependency, type.fullname(), here, self.fullname());
 #endif
     ymAssert(!_session.has_value());
     ymAssert(height() == 0);
     _session = _Sess{
-        .errPrefix = std::move(errPrefix),
+        .dependency = std::move(dependency),
         .env = _Env{
             .type = type,
             .here = std::move(here),
@@ -90,6 +92,10 @@ void _ym::TermStk::endSession() {
     _session.reset();
 }
 
+bool _ym::TermStk::inSession() const noexcept {
+    return _session.has_value();
+}
+
 void _ym::TermStk::push(_ym::Term x) {
     _assertSess();
 #if _DUMP_LOG
@@ -216,7 +222,7 @@ YmParcel* _ym::TermStk::importParcel() {
         return nullptr;
     }
     else {
-        return _import(t.path().value());
+        return _import(*t.path());
     }
 }
 
@@ -233,7 +239,7 @@ void _ym::TermStk::path(const Spec& path) {
     ym::println("TermStk: {} {}", __func__, path);
 #endif
     _assertSess();
-    push(Term(path.assertPath()));
+    push(Term(path));
 }
 
 void _ym::TermStk::fullname(const Spec& fullname) {
@@ -268,15 +274,15 @@ void _ym::TermStk::here() {
     }
 }
 
-void _ym::TermStk::root(const std::string& id) {
+void _ym::TermStk::root(std::string_view id) {
 #if _DUMP_LOG
     ym::println("TermStk: {} {}", __func__, id);
 #endif
     _assertSess();
-    push(Term(id));
+    push(Term(std::string(id)));
 }
 
-void _ym::TermStk::subdir(const std::string& id) {
+void _ym::TermStk::subdir(std::string_view id) {
 #if _DUMP_LOG
     ym::println("TermStk: {} {}", __func__, id);
 #endif
@@ -295,7 +301,10 @@ void _ym::TermStk::subdir(const std::string& id) {
             t.fmt());
     }
     else {
-        transact(1, Term(std::format("{}/{}", t.fmt(), id)));
+        // Extended in place, as path terms aren't interned.
+        auto& path = t.data.as<1>().path;
+        path += '/';
+        path += id;
     }
 }
 
@@ -316,7 +325,7 @@ void _ym::TermStk::self() {
     }
 }
 
-void _ym::TermStk::typeParam(const std::string& id) {
+void _ym::TermStk::typeParam(std::string_view id) {
 #if _DUMP_LOG
     ym::println("TermStk: {} {}", __func__, id);
 #endif
@@ -342,7 +351,7 @@ void _ym::TermStk::typeParam(const std::string& id) {
     }
 }
 
-void _ym::TermStk::typeInParcel(const std::string& id) {
+void _ym::TermStk::typeInParcel(std::string_view id) {
 #if _DUMP_LOG
     ym::println("TermStk: {} {}", __func__, id);
 #endif
@@ -368,7 +377,7 @@ void _ym::TermStk::typeInParcel(const std::string& id) {
     else transactErr(1); // Don't forget!
 }
 
-void _ym::TermStk::member(const std::string& id) {
+void _ym::TermStk::member(std::string_view id) {
 #if _DUMP_LOG
     ym::println("TermStk: {} {}", __func__, id);
 #endif
@@ -416,8 +425,11 @@ void _ym::TermStk::member(const std::string& id) {
             t.fmt(),
             id);
     }
+    else if (auto memberType = ym::deref(t.concrete()).member(id).value().type()) {
+        transact(1, Term(ym::Safe(memberType)));
+    }
     else {
-        transact(1, Term(ym::deref(t.concrete()).member(id).value().type()));
+        transactErr(1); // Materialization raises its own errors.
     }
 }
 
@@ -525,7 +537,7 @@ void _ym::TermStk::endArgs() {
     transact(
         inputs.size(),
         Term(genNonMemberTypeDataCallback(
-            ym::deref(_import(generic.path().value())),
+            ym::deref(_import(*generic.path())),
             ym::deref(generic.info()),
             _assembleTypeArgs(args))));
 }
@@ -546,8 +558,12 @@ const _ym::TermStk::_Sess& _ym::TermStk::_sess() const noexcept {
     return *_session;
 }
 
-const std::string& _ym::TermStk::_errPrefix() const noexcept {
-    return _sess().errPrefix;
+std::string _ym::TermStk::_errPrefix() const {
+    const auto& sess = _sess();
+    return
+        sess.dependency
+        ? std::format("{} dependency {}", ym::deref(_env()).type->fullname(), *sess.dependency)
+        : sess.errPrefix;
 }
 
 const _ym::TermStk::_Env* _ym::TermStk::_env() const noexcept {
@@ -555,22 +571,21 @@ const _ym::TermStk::_Env* _ym::TermStk::_env() const noexcept {
     return e ? &*e : nullptr;
 }
 
-YmParcel* _ym::TermStk::_import(const Spec& path) {
-    path.assertPath();
+YmParcel* _ym::TermStk::_import(std::string_view path) {
+    // Lookups are done w/ path as is, so it needn't be interned.
     if (auto existing = staging->parcels.fetch(path)) {
         return existing.get();
     }
     if (auto binding = binds->get(path); staging->parcels.push(binding)) {
         binding->resolveRedirects(*redirects);
+        return binding.get();
     }
-    else {
-        _err(
-            YmErrCode_ParcelNotFound,
-            "{}; no parcel found at path \"{}\"!",
-            _errPrefix(),
-            path);
-    }
-    return staging->parcels.fetch(path).get();
+    _err(
+        YmErrCode_ParcelNotFound,
+        "{}; no parcel found at path \"{}\"!",
+        _errPrefix(),
+        path);
+    return nullptr;
 }
 
 std::optional<size_t> _ym::TermStk::_countInputsToEndArgs() const noexcept {
@@ -582,12 +597,12 @@ std::optional<size_t> _ym::TermStk::_countInputsToEndArgs() const noexcept {
     return std::nullopt;
 }
 
-std::vector<ym::Safe<YmType>> _ym::TermStk::_assembleTypeArgs(std::span<const Term> args) {
-    std::vector<ym::Safe<YmType>> result{};
+std::span<const ym::Safe<YmType>> _ym::TermStk::_assembleTypeArgs(std::span<const Term> args) {
+    _typeArgs.clear();
     for (const auto& arg : args) {
-        result.push_back(ym::Safe(arg.type()));
+        _typeArgs.push_back(ym::Safe(arg.type()));
     }
-    return result;
+    return _typeArgs;
 }
 
 void _ym::TermStk::_printTermStk(size_t oldHeight) {
@@ -615,6 +630,7 @@ _ym::TermStk::_Interp::_Interp(TermStk& client) :
 
 void _ym::TermStk::_Interp::operator()(const std::string& specifier) {
     _specifierPtr = &specifier;
+    YM_LOAD_STAT(SpecifiersParsed, 1);
     eval(SpecParser{}(taul::str(specifier)));
 }
 
@@ -627,27 +643,23 @@ void _ym::TermStk::_Interp::syntaxErr() {
 }
 
 void _ym::TermStk::_Interp::rootId(const taul::str& id) {
-    using namespace taul::string_literals;
-    if (id == "%here"_str)                  _client->here();
-    else if (id == "$Self"_str)             _client->self();
-    // TODO: Remove the avoidable std::string heap alloc.
-    else if (id.substr(0, 1) == "$"_str)    _client->typeParam(std::string(id.substr(1)));
-    else                                    _client->root(std::string(id));
+    const std::string_view s(id.data(), id.size());
+    if (s == "%here")               _client->here();
+    else if (s == "$Self")          _client->self();
+    else if (s.starts_with('$'))    _client->typeParam(s.substr(1));
+    else                            _client->root(s);
 }
 
 void _ym::TermStk::_Interp::slashId(const taul::str& id) {
-    // TODO: Remove the avoidable std::string heap alloc.
-    _client->subdir(std::string(id));
+    _client->subdir(std::string_view(id.data(), id.size()));
 }
 
 void _ym::TermStk::_Interp::colonId(const taul::str& id) {
-    // TODO: Remove the avoidable std::string heap alloc.
-    _client->typeInParcel(std::string(id));
+    _client->typeInParcel(std::string_view(id.data(), id.size()));
 }
 
 void _ym::TermStk::_Interp::dblColonId(const taul::str& id) {
-    // TODO: Remove the avoidable std::string heap alloc.
-    _client->member(std::string(id));
+    _client->member(std::string_view(id.data(), id.size()));
 }
 
 void _ym::TermStk::_Interp::openTypeArgs() {
@@ -3,7 +3,10 @@
 #pragma once
 
 
+#include <span>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "../yama/yama.h"
 #include "../yama++/meta.h"
@@ -24,20 +27,25 @@ namespace _ym {
     //          - Errors: Encapsulates error from failed operation.
     //              * These exist to make system more stable in situations where an operation fails, as
     //                instead pushing nothing to term stack leaves it malformed, which can lead to crashes.
-    //          - Paths: Encapsulates path strings (ie. no actual import has necessarily occurred.)
+    //          - Paths: Encapsulates paths (ie. no actual import has necessarily occurred.)
     //          - Types: Encapsulates concrete/generic types (ie. w/ an associated fullname.)
+    //
+    //       Path terms hold plain strings (rather than interned specifiers), as they're usually transient
+    //       prefixes of the specifiers being evaluated, w/ interning them needing the intern pool's lock.
+    //       Other terms hold only handles (ie. interned path specifiers, and type/info pointers), so
+    //       pushing, popping and copying them doesn't allocate.
 
     struct Term final {
         struct ErrorData final {
         };
         struct PathData final {
-            std::string path;
+            std::string path; // Normalized.
         };
         struct ConcreteData final {
             ym::Safe<YmType> type;
         };
         struct GenericData final {
-            std::string path;
+            Spec path;
             ym::Safe<const TypeInfo> info;
         };
         ym::Variant<
@@ -45,7 +53,7 @@ namespace _ym {
             PathData,
             ConcreteData,
             GenericData
-        > data = PathData{};
+        > data;
 
         bool awaitingArgs = false;
 
@@ -62,16 +70,20 @@ namespace _ym {
         Term& operator=(Term&&) noexcept = default;
 
         // For paths.
+        inline explicit Term(const Spec& path) :
+            Term(std::string(path.assertPath().string())) {
+        }
+        // For paths, w/ path being normalized.
         inline explicit Term(std::string path) :
-            data(PathData(std::move(path))) {
+            data(PathData{ std::move(path) }) {
         }
         // For concrete types.
         inline explicit Term(ym::Safe<YmType> type) :
             data(ConcreteData(type)) {
         }
         // For generic types.
-        inline Term(std::string path, ym::Safe<const TypeInfo> info) :
-            data(GenericData{ std::move(path), info }) {
+        inline Term(Spec path, ym::Safe<const TypeInfo> info) :
+            data(GenericData{ std::move(path.assertPath()), info }) {
             ymAssert(info->isParameterized());
         }
 
@@ -93,16 +105,16 @@ namespace _ym {
             if (auto k = kind())    return ymKind_CanHaveMembers(*k) == YM_TRUE;
             else                    return false;
         }
-        inline bool hasMember(const std::string& name) const noexcept {
+        inline bool hasMember(std::string_view name) const noexcept {
             return
                 isType()
-                ? info()->member(name)
+                ? info()->member(name) != nullptr
                 : false;
         }
 
-        inline std::optional<Spec> path() const {
-            if (auto result = data.tryAs<1>())      return Spec::path(result->path);
-            else if (auto result = data.tryAs<3>()) return Spec::path(result->path);
+        inline std::optional<std::string_view> path() const noexcept {
+            if (auto result = data.tryAs<1>())      return result->path;
+            else if (auto result = data.tryAs<3>()) return result->path.string();
             else                                    return std::nullopt;
         }
         inline YmType* concrete() const noexcept {
@@ -133,16 +145,16 @@ namespace _ym {
         inline std::string fmt(bool includeTermType = false) const {
             if (!includeTermType) {
                 if (isErr())            return "<error>";
-                else if (isPath())      return path().value();
+                else if (isPath())      return std::string(*path());
                 else if (isConcrete())  return type()->fullname();
-                else if (isGeneric())   return std::format("{}:{}", path().value(), info()->localName());
+                else if (isGeneric())   return std::format("{}:{}", *path(), info()->localName());
                 else                    return "???";
             }
             else {
                 if (isErr())            return "[Error]";
-                else if (isPath())      return "[Path " + path().value().fmt() + "]";
+                else if (isPath())      return "[Path " + std::string(*path()) + "]";
                 else if (isConcrete())  return "[Concrete " + type()->fullname().string() + "]";
-                else if (isGeneric())   return "[Generic " + std::format("{}:{}", path().value(), info()->localName()) + "]";
+                else if (isGeneric())   return "[Generic " + std::format("{}:{}", *path(), info()->localName()) + "]";
                 else                    return "[???]";
             }
         }
@@ -155,7 +167,8 @@ namespace _ym {
         // Negative values index from top-down, Lua-style, where -1 is the top term.
         using TermIndex = std::make_signed_t<size_t>;
 
-        using GenNonMemberTypeDataCallback = std::function<ym::Safe<YmType>(YmParcel& p, const TypeInfo& info, std::vector<ym::Safe<YmType>> typeArgs)>;
+        // typeArgs is only valid for the duration of the call.
+        using GenNonMemberTypeDataCallback = std::function<ym::Safe<YmType>(YmParcel& p, const TypeInfo& info, std::span<const ym::Safe<YmType>> typeArgs)>;
 
 
         const ym::Safe<Area> staging;
@@ -179,17 +192,21 @@ namespace _ym {
         std::span<const Term> topN(size_t n) const noexcept;
 
 
+        // dependency is the ref sym (of type) being processed.
         // type is the type who's ref syms are being processed.
         // here is the %here path.
         // self is the $Self type.
+        // The error prefix is generated from dependency and type lazily, upon an error arising, so
+        // fullnames needn't be generated for sessions which succeed.
         void beginSession(
-            std::string errPrefix,
+            Spec dependency,
             YmType& type,
-            std::string here,
+            Spec here,
             YmType& self);
         void beginSession(
             std::string errPrefix);
         void endSession();
+        bool inSession() const noexcept;
 
 
         // Pushes x to the term stack.
@@ -276,12 +293,12 @@ namespace _ym {
 
         // StkFx: ... -- ... <root>
         // <root> is a root import path.
-        void root(const std::string& id);
+        void root(std::string_view id);
 
         // StkFx: ... <file> -- ... <subdir>
         // <file> is a path specifying a file/directory.
         // <subdir> is a path to a subdirectory within <file> (ie. '<file>/<id>'.)
-        void subdir(const std::string& id);
+        void subdir(std::string_view id);
 
         // StkFx: ... -- ... <self>
         // <self> is the type resolved by $Self.
@@ -289,17 +306,17 @@ namespace _ym {
 
         // StkFx: ... -- ... <typeParam>
         // <typeParam> is the type resolved by the specified type parameter (ie. '$<id>'.)
-        void typeParam(const std::string& id);
+        void typeParam(std::string_view id);
 
         // StkFx: ... <path> -- ... <type>
         // <path> is an import path.
         // <type> is an type within the parcel at <path> (ie. '<path>:<id>'.)
-        void typeInParcel(const std::string& id);
+        void typeInParcel(std::string_view id);
 
         // StkFx: ... <owner> -- ... <member>
         // <owner> is a non-member type.
         // <member> is a member type within <owner> (ie. '<owner>::<id>'.)
-        void member(const std::string& id);
+        void member(std::string_view id);
 
         // StkFx: ... <generic> -- ... <generic>
         // <generic> is the top-most generic type term.
@@ -316,11 +333,12 @@ namespace _ym {
     private:
         struct _Env final {
             ym::Safe<YmType> type;
-            std::string here;
+            Spec here;
             ym::Safe<YmType> self;
         };
         struct _Sess final {
-            std::string errPrefix;
+            std::string errPrefix; // Unused if dependency has value.
+            std::optional<Spec> dependency;
             std::optional<_Env> env;
         };
 
@@ -355,15 +373,19 @@ namespace _ym {
         };
 
 
+        // NOTE: The below buffers are reused across sessions (ie. they're cleared, not freed), so
+        //       evaluation doesn't allocate once they've grown to fit the specifiers evaluated.
+
         std::optional<_Sess> _session;
         std::vector<Term> _terms;
+        std::vector<ym::Safe<YmType>> _typeArgs; // Used by endArgs.
 
 
         size_t _absInd(TermIndex index) const noexcept;
 
         void _assertSess() const noexcept;
         const _Sess& _sess() const noexcept;
-        const std::string& _errPrefix() const noexcept;
+        std::string _errPrefix() const;
         const _Env* _env() const noexcept;
 
         template<typename... Args>
@@ -374,10 +396,10 @@ namespace _ym {
             _ym::Global::raiseErr(code, fmt, std::forward<Args>(args)...);
         }
 
-        YmParcel* _import(const Spec& path);
+        YmParcel* _import(std::string_view path);
 
         std::optional<size_t> _countInputsToEndArgs() const noexcept;
-        static std::vector<ym::Safe<YmType>> _assembleTypeArgs(std::span<const Term> args);
+        std::span<const ym::Safe<YmType>> _assembleTypeArgs(std::span<const Term> args);
 
         void _printTermStk(size_t oldHeight);
     };
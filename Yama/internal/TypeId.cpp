@@ -0,0 +1,65 @@
+#include "TypeId.h"
+
+#include <algorithm>
+
+#include "../yama++/hash.h"
+
+
+_ym::TypeId::TypeId(
+    const YmParcel& parcel,
+    const TypeInfo& info,
+    std::span<const ym::Safe<YmType>> typeArgs) :
+    _parcel(parcel),
+    _info(info),
+    _owner(nullptr),
+    _typeArgs(typeArgs),
+    _hash(_computeHash()) {
+}
+
+_ym::TypeId::TypeId(
+    const YmParcel& parcel,
+    const TypeInfo& info,
+    const YmType& owner) :
+    _parcel(parcel),
+    _info(info),
+    _owner(&owner),
+    _typeArgs(),
+    _hash(_computeHash()) {
+}
+
+bool _ym::TypeId::operator==(const TypeId& other) const noexcept {
+    return
+        _hash == other._hash &&
+        _parcel == other._parcel &&
+        _info == other._info &&
+        _owner == other._owner &&
+        std::ranges::equal(_typeArgs, other._typeArgs);
+}
+
+const YmParcel& _ym::TypeId::parcel() const noexcept {
+    return *_parcel;
+}
+
+const _ym::TypeInfo& _ym::TypeId::info() const noexcept {
+    return *_info;
+}
+
+const YmType* _ym::TypeId::owner() const noexcept {
+    return _owner;
+}
+
+std::span<const ym::Safe<YmType>> _ym::TypeId::typeArgs() const noexcept {
+    return _typeArgs;
+}
+
+size_t _ym::TypeId::hash() const noexcept {
+    return _hash;
+}
+
+size_t _ym::TypeId::_computeHash() const noexcept {
+    size_t result = ym::hash(_parcel.get(), _info.get(), _owner);
+    for (const auto& arg : _typeArgs) {
+        result = ym::hashCombine(result, arg.hash());
+    }
+    return result;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+
+#include <span>
+
+#include "../yama/yama.h"
+#include "../yama++/Safe.h"
+
+
+namespace _ym {
+
+
+    class TypeInfo;
+
+
+    // Structural identity of a type, being the tuple (parcel, type info, owner, type args.)
+    // Types are deduplicated upon load, so owners and type args are identified by pointer, making
+    // type ids the nodes of a hash-consed DAG, w/ hashing/comparing being O(number of type args)
+    // rather than O(fullname length.)
+    // Type ids don't own their type args, w/ the type args span needing to outlive the type id.
+    class TypeId final {
+    public:
+        // For non-member types.
+        TypeId(
+            const YmParcel& parcel,
+            const TypeInfo& info,
+            std::span<const ym::Safe<YmType>> typeArgs);
+        // For member types.
+        TypeId(
+            const YmParcel& parcel,
+            const TypeInfo& info,
+            const YmType& owner);
+
+
+        bool operator==(const TypeId& other) const noexcept;
+
+        const YmParcel& parcel() const noexcept;
+        const TypeInfo& info() const noexcept;
+        const YmType* owner() const noexcept;
+        std::span<const ym::Safe<YmType>> typeArgs() const noexcept;
+
+        size_t hash() const noexcept;
+
+
+    private:
+        ym::Safe<const YmParcel> _parcel;
+        ym::Safe<const TypeInfo> _info;
+        const YmType* _owner;
+        std::span<const ym::Safe<YmType>> _typeArgs;
+        size_t _hash; // Precomputed.
+
+
+        size_t _computeHash() const noexcept;
+    };
+}
+
+template<>
+struct std::hash<_ym::TypeId> final {
+    inline size_t operator()(const _ym::TypeId& x) const noexcept {
+        return x.hash();
+    }
+};
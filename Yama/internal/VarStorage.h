@@ -25,6 +25,9 @@ namespace _ym {
 		void initialize(YmType& varType);
 		void reset() noexcept;
 
+		// Returns the objects of initialized vars, by var.
+		inline const std::unordered_map<const TypeInfo*, YmObj*>& vars() const noexcept { return _storage; }
+
 
 	private:
 		YmCtx* _ctx;
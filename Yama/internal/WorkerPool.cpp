@@ -0,0 +1,71 @@
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+
+_ym::WorkerPool::WorkerPool(size_t workers) {
+	_workers.reserve(workers);
+	for (size_t i = 0; i < workers; i++) {
+		_workers.emplace_back([this](std::stop_token stop) { _workerMain(stop); });
+	}
+}
+
+_ym::WorkerPool& _ym::WorkerPool::global() {
+	static WorkerPool* const pool = new WorkerPool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+	return *pool;
+}
+
+size_t _ym::WorkerPool::workers() const noexcept {
+	return _workers.size();
+}
+
+void _ym::WorkerPool::forEach(size_t n, const std::function<void(size_t)>& f) {
+	// Not worth waking workers for.
+	if (n <= 1 || workers() == 0) {
+		for (size_t i = 0; i < n; i++) {
+			f(i);
+		}
+		return;
+	}
+	auto job = std::make_shared<_Job>(f, n);
+	{
+		std::scoped_lock lk(_lock);
+		_jobs.push_back(job);
+	}
+	_jobCV.notify_all();
+	_work(*job);
+	std::unique_lock lk(_lock);
+	_doneCV.wait(lk, [&] { return job->done.load() == n; });
+	// Workers may still hold job, but as no calls remain to be claimed, they won't touch f.
+	std::erase(_jobs, job);
+}
+
+void _ym::WorkerPool::_workerMain(std::stop_token stop) {
+	while (true) {
+		std::shared_ptr<_Job> job{};
+		{
+			std::unique_lock lk(_lock);
+			if (!_jobCV.wait(lk, stop, [&] { return !_jobs.empty(); })) {
+				return; // Stop requested.
+			}
+			job = _jobs.front();
+			// Jobs w/ no calls left to claim are retired, so workers move on to the next one.
+			if (job->next.load() >= job->n) {
+				_jobs.pop_front();
+				continue;
+			}
+		}
+		_work(*job);
+	}
+}
+
+void _ym::WorkerPool::_work(_Job& job) {
+	for (size_t i = job.next++; i < job.n; i = job.next++) {
+		job.f(i);
+		if (++job.done == job.n) {
+			// Lock so the notify can't slip in between the caller's predicate check and its wait.
+			std::scoped_lock lk(_lock);
+			_doneCV.notify_all();
+		}
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace _ym {
+
+
+	// Thread-safe pool of worker threads, used to split up independent units of work (ie. the
+	// per-type checks of a load) across cores.
+	// Callers of forEach participate in their own jobs, so jobs always make progress (ie. even
+	// w/ all workers busy w/ the jobs of other callers.)
+	class WorkerPool final {
+	public:
+		explicit WorkerPool(size_t workers);
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool(WorkerPool&&) = delete;
+		~WorkerPool() noexcept = default;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+		WorkerPool& operator=(WorkerPool&&) = delete;
+
+		// The global pool is immortal, and is started lazily, upon first use, w/ a worker per
+		// hardware thread other than the caller's.
+		static WorkerPool& global();
+
+
+		// Returns the number of worker threads (ie. excluding callers of forEach.)
+		size_t workers() const noexcept;
+
+		// Calls f(i) for each i in [0, n), across the calling thread and the workers, in no
+		// particular order, returning once all calls have returned.
+		// f must be safe to call concurrently, and must not throw.
+		void forEach(size_t n, const std::function<void(size_t)>& f);
+
+
+	private:
+		struct _Job final {
+			const std::function<void(size_t)>& f;
+			const size_t n;
+			std::atomic<size_t> next = 0, done = 0;
+
+
+			inline _Job(const std::function<void(size_t)>& f, size_t n) :
+				f(f),
+				n(n) {
+			}
+		};
+
+
+		std::mutex _lock; // Protects _jobs.
+		std::condition_variable_any _jobCV, _doneCV;
+		std::deque<std::shared_ptr<_Job>> _jobs;
+		std::vector<std::jthread> _workers; // Declared last, so they're joined before the rest of us is destroyed.
+
+
+		void _workerMain(std::stop_token stop);
+		// Performs calls of job until none remain to be claimed.
+		void _work(_Job& job);
+	};
+}
+
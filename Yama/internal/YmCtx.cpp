@@ -2,12 +2,16 @@
 
 #include "YmCtx.h"
 
+#include <algorithm>
+#include <map>
 #include <ranges>
+#include <utility>
 
 #include "general.h"
 #include "SpecSolver.h"
 #include "YmObj.h"
 #include "YmParcel.h"
+#include "YmSuspension.h"
 #include "YmType.h"
 
 #include "../yama++/resources.h"
@@ -15,8 +19,13 @@
 
 
 YmCtx::YmCtx(ym::Safe<YmDm> domain) :
+    YmCtx(domain, domain->allocator) {}
+
+YmCtx::YmCtx(ym::Safe<YmDm> domain, std::optional<YmAllocator> allocator) :
     domain(domain),
     loader(std::make_shared<_ym::CtxLoader>(domain->loader)),
+    allocator(allocator),
+    mas(_ym::makeCtxMAS(allocator)),
     _vars(*this) {
     _beginUserPseudoCall();
 }
@@ -27,6 +36,7 @@ YmCtx::~YmCtx() noexcept {
 }
 
 std::shared_ptr<YmParcel> YmCtx::import(const std::string& path) {
+    YM_LOAD_STATS_SCOPE(loader->stats());
     if (auto s = _ym::Spec::path(path)) {
         return loader->import(*s);
     }
@@ -40,6 +50,7 @@ std::shared_ptr<YmParcel> YmCtx::import(const std::string& path) {
 }
 
 std::shared_ptr<YmType> YmCtx::load(const std::string& fullname) {
+    YM_LOAD_STATS_SCOPE(loader->stats());
     if (auto s = _ym::Spec::type(fullname)) {
         return loader->load(*s);
     }
@@ -80,12 +91,51 @@ YmType& YmCtx::ldType() const noexcept {
     return loader->ldType();
 }
 
+std::optional<YmPrimitiveKind> YmCtx::primitiveKind(const YmType& type) const noexcept {
+    static_assert(YmPrimitiveKind_Num == 7);
+    if (&type == &ldNone())         return YmPrimitiveKind_None;
+    else if (&type == &ldInt())     return YmPrimitiveKind_Int;
+    else if (&type == &ldUInt())    return YmPrimitiveKind_UInt;
+    else if (&type == &ldFloat())   return YmPrimitiveKind_Float;
+    else if (&type == &ldBool())    return YmPrimitiveKind_Bool;
+    else if (&type == &ldRune())    return YmPrimitiveKind_Rune;
+    else if (&type == &ldType())    return YmPrimitiveKind_Type;
+    else                            return std::nullopt;
+}
+
 YmObj* YmCtx::create(YmType& type) {
+    YmObj header(*this, type);
+    const size_t bytes = _ym::ObjHAL::bytes(header.size());
+    // Objects allocated by the end-user directly (ie. in the user call frame) don't count
+    // against the limit, as there's no call to interrupt.
+    if (_memLimit > 0 && _mem.bytes() + bytes > _memLimit && !isUser()) {
+        // Only raise for the allocation which exceeded the limit, not ones made by the call
+        // as it's being interrupted due to it.
+        if (!std::exchange(_memLimitExceeded, true)) {
+            _ym::Global::raiseErr(
+                YmErrCode_MemLimitExceeded,
+                "Cannot create {}; memory limit ({} bytes) exceeded!",
+                type.fullname(),
+                _memLimit);
+        }
+        return nullptr;
+    }
     auto al = mas.allocator<int>();
-    ym::Safe result(_ym::ObjHAL::create(YmObj(*this, type), al));
+    auto block = _ym::ObjHAL::create(std::move(header), al);
+    if (!block) {
+        _ym::Global::raiseErr(
+            YmErrCode_MemLimitExceeded,
+            "Cannot create {}; allocator failed to allocate {} bytes!",
+            type.fullname(),
+            bytes);
+        return nullptr;
+    }
+    ym::Safe result(block);
     result->refs.addRef();
     ymAssert(result->refs.count() == 1);
     _objects.insert(result);
+    YM_CTX_STAT(stats, ObjectsCreated, 1);
+    _mem.alloc(bytes);
     return result;
 }
 
@@ -108,9 +158,7 @@ YmRefCount YmCtx::release(YmObj& obj) {
         ym::println("-- YmCtx::release {}: Release!", (void*)&obj);
 #endif
         obj.cleanup(); // Can't forget!
-        _objects.erase(&obj);
-        auto al = mas.allocator<int>();
-        _ym::ObjHAL::destroy(obj, al);
+        _free(obj);
     }
     return old;
 }
@@ -121,6 +169,9 @@ void YmCtx::reset() {
     _endCall();
     // Reset our vars.
     _vars.reset();
+    // Invalidate suspensions, as their objects are about to be released.
+    _epoch++;
+    _suspended = false;
     // Copy _objects and iterate over the copy as otherwise we'd be modifying
     // objects as we iterate over it.
     auto objects = _objects;
@@ -128,47 +179,68 @@ void YmCtx::reset() {
         while (release(*object) > 1) {}
     }
     ymAssert(_objects.empty());
+    _mem.reset();
+    // Don't let interrupts carry over.
+    _clearInterrupt();
     // Begin new user pseudo-call.
     _beginUserPseudoCall();
 }
 
-ym::Safe<YmObj> YmCtx::newNone() {
-    return ym::Safe(create(loader->ldNone()));
+void YmCtx::unload() noexcept {
+    ymAssert(_objects.empty());
+    _ptables.reset();
+    loader->reset();
 }
 
-ym::Safe<YmObj> YmCtx::newInt(YmInt v) {
-    auto result = ym::Safe(create(loader->ldInt()));
-    result->slot(0).i = v;
+YmObj* YmCtx::newNone() {
+    return create(loader->ldNone());
+}
+
+YmObj* YmCtx::newInt(YmInt v) {
+    auto result = create(loader->ldInt());
+    if (result) {
+        result->slot(0).i = v;
+    }
     return result;
 }
 
-ym::Safe<YmObj> YmCtx::newUInt(YmUInt v) {
-    auto result = ym::Safe(create(loader->ldUInt()));
-    result->slot(0).ui = v;
+YmObj* YmCtx::newUInt(YmUInt v) {
+    auto result = create(loader->ldUInt());
+    if (result) {
+        result->slot(0).ui = v;
+    }
     return result;
 }
 
-ym::Safe<YmObj> YmCtx::newFloat(YmFloat v) {
-    auto result = ym::Safe(create(loader->ldFloat()));
-    result->slot(0).f = v;
+YmObj* YmCtx::newFloat(YmFloat v) {
+    auto result = create(loader->ldFloat());
+    if (result) {
+        result->slot(0).f = v;
+    }
     return result;
 }
 
-ym::Safe<YmObj> YmCtx::newBool(YmBool v) {
-    auto result = ym::Safe(create(loader->ldBool()));
-    result->slot(0).b = v;
+YmObj* YmCtx::newBool(YmBool v) {
+    auto result = create(loader->ldBool());
+    if (result) {
+        result->slot(0).b = v;
+    }
     return result;
 }
 
-ym::Safe<YmObj> YmCtx::newRune(YmRune v) {
-    auto result = ym::Safe(create(loader->ldRune()));
-    result->slot(0).r = _uint2rune((YmUInt)v);
+YmObj* YmCtx::newRune(YmRune v) {
+    auto result = create(loader->ldRune());
+    if (result) {
+        result->slot(0).r = _uint2rune((YmUInt)v);
+    }
     return result;
 }
 
-ym::Safe<YmObj> YmCtx::newType(YmType& v) {
-    auto result = ym::Safe(create(loader->ldType()));
-    result->slot(0).type = &v;
+YmObj* YmCtx::newType(YmType& v) {
+    auto result = create(loader->ldType());
+    if (result) {
+        result->slot(0).type = &v;
+    }
     return result;
 }
 
@@ -361,6 +433,7 @@ bool YmCtx::put(YmLocal where, YmObj* what, YmRefPolicy whatPolicy) {
     }
     if (where == YM_PUSH) {
         _globalObjStk.push_back(_what);
+        YM_CTX_STAT_PEAK(stats, PeakObjectStackHeight, _globalObjStk.size());
         if (whatPolicy == YM_BORROW) {
             secure(_what);
         }
@@ -475,14 +548,18 @@ bool YmCtx::structInit(YmType* type, std::string_view argNames, YmLocal where) {
             }
             uint8_t argOffset = argPack.argOffset(storedPropertySlot, true).value();
             auto& arg = ym::deref(local(locals() - YmLocals(argNameCount) + argOffset));
-            if (arg.type != getter->type().returnType()) {
+            const auto getterType = getter->type();
+            if (!getterType) {
+                return false; // Materialization raises its own errors.
+            }
+            if (arg.type != getterType->returnType()) {
                 _ym::Global::raiseErr(
                     YmErrCode_TypeMismatch,
                     "Struct init failed; arg #{} (for stored property {}) is {}, but expected {}!",
                     argOffset + 1,
                     (std::string)argName,
                     arg.type->fullname(),
-                    getter->type().fullname());
+                    getterType->fullname());
                 return false;
             }
         }
@@ -501,7 +578,10 @@ bool YmCtx::structInit(YmType* type, std::string_view argNames, YmLocal where) {
             "Struct init failed; not all stored properties specified!");
         return false;
     }
-    auto result = ym::Safe(create(_type));
+    auto result = create(_type);
+    if (!result) {
+        return false;
+    }
     for (uint16_t storedPropertyInd = 0; storedPropertyInd < storedProperties; storedPropertyInd++) {
         // TODO: But what if storedProperties exceeds 8-bit max?
         uint8_t argOffset = argPack.argOffset(YmUInt8(storedPropertyInd), true).value();
@@ -518,13 +598,227 @@ bool YmCtx::structInit(YmType* type, std::string_view argNames, YmLocal where) {
 }
 
 bool YmCtx::call(YmType* fn, YmUInt16 argsN, std::string_view argNames, YmLocal returnTo) {
+    if (isUser()) {
+        _suspended = false;
+    }
     if (_beginCall(fn, argsN, argNames, returnTo)) {
         _dispatchCall(fn);
-        return _endCall();
+        return _finishCall();
+    }
+    return false;
+}
+
+void YmCtx::requestInterrupt() noexcept {
+    _interrupt.store(true, std::memory_order_relaxed);
+}
+
+void YmCtx::setCallTimeLimit(std::chrono::milliseconds limit) noexcept {
+    _callTimeLimit = limit;
+}
+
+bool YmCtx::interrupted() noexcept {
+    if (_memLimitExceeded || _interrupt.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    if (_deadline && std::chrono::steady_clock::now() >= *_deadline) {
+        _interrupt.store(true, std::memory_order_relaxed);
+        return true;
     }
     return false;
 }
 
+void YmCtx::memUsage(const YmType* type, YmUInt64* out) const noexcept {
+    if (!type) {
+        _mem.get(out);
+        return;
+    }
+    // Stats of objects of type are computed by walking our objects, rather than tracked upon
+    // each alloc/dealloc, as such queries are rare, and allocating objects is not.
+    std::fill_n(out, size_t(YmMemStat_Num), YmUInt64(0));
+    for (const auto& obj : _objects) {
+        if (obj->type.get() == type) {
+            out[YmMemStat_Bytes] += _ym::ObjHAL::bytes(obj->size());
+            out[YmMemStat_Objects]++;
+        }
+    }
+}
+
+void YmCtx::setMemLimit(YmUInt64 limit) noexcept {
+    _memLimit = limit;
+}
+
+std::string YmCtx::heapSnapshot(bool graph) const {
+    // Escape names, so the JSON stays valid regardless of the characters they contain.
+    auto str = [](std::string_view x) -> std::string {
+        std::string result = "\"";
+        for (const auto& c : x) {
+            if (c == '"' || c == '\\')      result += std::format("\\{}", c);
+            else if (YmUInt8(c) < 0x20)     result += std::format("\\u{:04x}", YmUInt8(c));
+            else                            result += c;
+        }
+        return result + "\"";
+        };
+    struct TypeEntry final {
+        std::string fullname;
+        YmUInt64 objects = 0, bytes = 0;
+        std::map<YmRefCount, YmUInt64> refCounts; // Ref count histogram.
+    };
+    // Objects are walked via _objects, so snapshots cost nothing when not being taken.
+    std::unordered_map<const YmType*, TypeEntry> types{};
+    std::unordered_map<const YmObj*, size_t> ids{};
+    YmUInt64 bytes = 0;
+    for (const auto& obj : _objects) {
+        auto& entry = types[obj->type.get()];
+        const YmUInt64 objBytes = _ym::ObjHAL::bytes(obj->size());
+        entry.objects++;
+        entry.bytes += objBytes;
+        entry.refCounts[obj->refs.count()]++;
+        bytes += objBytes;
+        ids.try_emplace(obj, ids.size());
+    }
+    std::vector<TypeEntry*> byBytes{};
+    for (auto& [type, entry] : types) {
+        entry.fullname = type->fullname().string();
+        byBytes.push_back(&entry);
+    }
+    std::ranges::sort(byBytes, std::greater{}, [](const TypeEntry* x) { return x->bytes; });
+    std::string result = std::format("{{\n\"objects\": {},\n\"bytes\": {},\n\"types\": [", _objects.size(), bytes);
+    for (size_t i = 0; i < byBytes.size(); i++) {
+        const auto& entry = *byBytes[i];
+        result += std::format("{}\n  {{\"type\": {}, \"objects\": {}, \"bytes\": {}, \"refCounts\": {{",
+            i > 0 ? "," : "", str(entry.fullname), entry.objects, entry.bytes);
+        for (bool first = true; const auto& [refCount, n] : entry.refCounts) {
+            result += std::format("{}\"{}\": {}", std::exchange(first, false) ? "" : ", ", refCount, n);
+        }
+        result += "}}";
+    }
+    result += "\n]";
+    if (graph) {
+        std::string nodes{}, edges{}, roots{};
+        auto append = [](std::string& list, std::string entry) {
+            list += std::format("{}\n  {}", list.empty() ? "" : ",", entry);
+            };
+        // Refs which are null, or to objects we don't know of, are emitted as null, rather than
+        // failing the whole snapshot.
+        auto idOf = [&ids](const YmObj* x) -> std::string {
+            if (auto it = ids.find(x); it != ids.end()) {
+                return std::to_string(it->second);
+            }
+            return "null";
+            };
+        for (const auto& [obj, id] : ids) {
+            append(nodes, std::format("{{\"id\": {}, \"type\": {}, \"refs\": {}}}", id, str(types.at(obj->type.get()).fullname), obj->refs.count()));
+            if (obj->isRegularStruct()) {
+                for (size_t i = 0; i < obj->type->info->slots; i++) {
+                    append(edges, std::format("{{\"from\": {}, \"to\": {}, \"slot\": {}}}", id, idOf(obj->slot(i).ref), i));
+                }
+            }
+            else if (obj->isProtocol()) {
+                append(edges, std::format("{{\"from\": {}, \"to\": {}, \"slot\": 0}}", id, idOf(obj->boxed())));
+            }
+        }
+        for (size_t i = 0; i < _globalObjStk.size(); i++) {
+            append(roots, std::format("{{\"to\": {}, \"kind\": \"local\", \"index\": {}}}", idOf(_globalObjStk[i].get()), i));
+        }
+        for (const auto& [var, obj] : _vars.vars()) {
+            append(roots, std::format("{{\"to\": {}, \"kind\": \"var\", \"var\": {}}}", idOf(obj), str(var->localName())));
+        }
+        for (size_t i = 0; i < _callStk.size(); i++) {
+            if (const auto& returnValue = _callStk[i].returnValue) {
+                append(roots, std::format("{{\"to\": {}, \"kind\": \"returnValue\", \"frame\": {}}}", idOf(returnValue), i));
+            }
+        }
+        result += std::format(",\n\"nodes\": [{}\n],\n\"edges\": [{}\n],\n\"roots\": [{}\n]", nodes, edges, roots);
+    }
+    return result + "\n}";
+}
+
+YmSuspension* YmCtx::suspend() {
+    if (isUser()) {
+        return nullptr;
+    }
+    if (!_suspending) {
+        _suspending = new YmSuspension(*this);
+        _suspending->refs.addRef(); // Ours.
+    }
+    _suspending->refs.addRef();
+    return _suspending;
+}
+
+bool YmCtx::resume(YmSuspension& suspension, YmLocal returnTo) {
+    ymAssert(suspension.ctx.get() == this);
+    if (!isUser()) {
+        _ym::Global::raiseErr(
+            YmErrCode_CallProcedureError,
+            "Resume failed; not in user call frame!");
+        return false;
+    }
+    if (!suspension.resumable()) {
+        _ym::Global::raiseErr(
+            YmErrCode_CallProcedureError,
+            "Resume failed; suspension is not resumable!");
+        return false;
+    }
+    if (!_absIndex(returnTo)) {
+        _ym::Global::raiseErr(
+            YmErrCode_LocalNotFound,
+            "Resume failed; local object index {} out-of-bounds!",
+            returnTo);
+        return false;
+    }
+    _suspended = false;
+    // Reattach call frames (outermost first), w/ outermost one returning to returnTo.
+    auto frames = std::move(suspension._frames);
+    suspension._frames.clear();
+    frames.back().cf.returnTo = returnTo;
+    for (auto it = frames.rbegin(); it != frames.rend(); it++) {
+        auto cf = it->cf;
+        cf.localsOffset += YmUInt32(_globalObjStk.size());
+        cf.resumed = true;
+        // Refs are moved from frame.
+        _globalObjStk.insert(_globalObjStk.end(), it->objs.begin(), it->objs.end());
+        _callStk.push_back(cf);
+    }
+    YM_CTX_STAT_PEAK(stats, PeakObjectStackHeight, _globalObjStk.size());
+    YM_CTX_STAT_PEAK(stats, PeakCallStackHeight, _callStk.size());
+    // Resuming begins a new call from the user call frame, so it gets a time limit of its own.
+    if (_callTimeLimit.count() > 0) {
+        _deadline = std::chrono::steady_clock::now() + _callTimeLimit;
+    }
+    // Resume innermost call, then, upon it completing, the call which made it, and so on.
+    while (true) {
+        auto& cf = _callStk.back();
+        auto& callBhvrInfo = ym::deref(cf.fn->info->callBehaviour());
+        // Pass calledFn, as _dispatchCall does, so forwarded protocol method calls see the method
+        // req they were called via, as they did before suspending.
+        callBhvrInfo.fn(this, cf.calledFn, callBhvrInfo.user);
+        auto result = _finishCall();
+        // Calls waiting on a call which failed (or suspended) fail (or suspend) too.
+        while (!result && !isUser()) {
+            if (_suspending) {
+                result = _finishCall();
+            }
+            else {
+                _abortCall();
+                if (isUser()) {
+                    _clearInterrupt(); // Call stack has unwound.
+                }
+            }
+        }
+        if (isUser()) {
+            return result;
+        }
+    }
+}
+
+bool YmCtx::resumed() const noexcept {
+    return _callStk.back().resumed;
+}
+
+bool YmCtx::suspended() const noexcept {
+    return _suspended;
+}
+
 bool YmCtx::ret(YmObj* what, YmRefPolicy whatPolicy) {
     if (!what) {
         return false;
@@ -751,6 +1045,8 @@ bool YmCtx::convert(YmType& type, YmLocal returnTo) {
     }
     auto inIsP = input.type->kind() == YmKind_Protocol;
     auto outIsP = type.kind() == YmKind_Protocol;
+    YM_CTX_STAT(stats, Conversions, 1);
+    YM_CTX_STAT_CONVERSION(stats, primitiveKind(*input.type), primitiveKind(type));
     if (input.type == &type) {
         return put(returnTo, ym::Safe(pull()), YM_TAKE);
     }
@@ -759,8 +1055,12 @@ bool YmCtx::convert(YmType& type, YmLocal returnTo) {
         return ymCtx_PutNone(this, returnTo) == YM_TRUE;
     }
     else if (!inIsP && outIsP) { // Box T -> P
-        if (auto ptable = _ptables.load(type, *input.type)) {
-            auto protoVal = ym::Safe(create(type));
+        if (auto ptable = _loadPTable(type, *input.type)) {
+            auto protoVal = create(type);
+            if (!protoVal) {
+                return false;
+            }
+            YM_CTX_STAT(stats, Boxings, 1);
             // Transfer object into box (ie. moving ownership of it.)
             protoVal->box(ym::Safe(pull()), *ptable);
             return put(returnTo, protoVal, YM_TAKE);
@@ -784,15 +1084,20 @@ bool YmCtx::convert(YmType& type, YmLocal returnTo) {
                 type.fullname());
             return false;
         }
+        YM_CTX_STAT(stats, Unboxings, 1);
         auto old = ym::bindScoped(ym::Safe(pull())); // RAII
         // The old protocol value might be referenced elsewhere, so it's ref can't
         // be stolen from it, so we pass YM_BORROW to copy the ref.
         return put(returnTo, old->boxed(), YM_BORROW);
     }
     else if (inIsP && outIsP) { // P -> P
-        if (auto ptable = _ptables.load(type, *input.boxed()->type)) {
+        if (auto ptable = _loadPTable(type, *input.boxed()->type)) {
+            auto protoVal = create(type);
+            if (!protoVal) {
+                return false;
+            }
+            YM_CTX_STAT(stats, Boxings, 1);
             auto old = ym::bindScoped(ym::Safe(pull())); // RAII
-            auto protoVal = ym::Safe(create(type));
             // The old protocol value might be referenced elsewhere, so it's ref can't
             // be stolen from it, so we add an incr for the new protocol value to own.
             secure(*old->boxed());
@@ -890,6 +1195,23 @@ bool YmCtx::convert(YmType& type, YmLocal returnTo) {
     }
 }
 
+bool YmCtx::marshal(YmCtx& src, YmLocal local) {
+    auto obj = src.local(local);
+    if (!obj) {
+        _ym::Global::raiseErr(
+            YmErrCode_LocalNotFound,
+            "Marshalling failed; local object index {} out-of-bounds!",
+            local);
+        return false;
+    }
+    std::unordered_map<const YmObj*, YmObj*> visited{};
+    auto copy = _marshal(*obj, visited, domain.get() != src.domain.get());
+    return
+        copy
+        ? put(YM_PUSH, copy, YM_TAKE)
+        : false;
+}
+
 void YmCtx::_beginUserPseudoCall() {
     ymAssert(_callStk.empty());
     _callStk.push_back(_CallFrame{
@@ -905,6 +1227,20 @@ bool YmCtx::_beginCall(YmType* fn, YmUInt16 args, std::string_view argNames, YmL
     }
     auto& _fn = ym::deref(fn);
     ymAssert(!_callStk.empty());
+    if (interrupted()) {
+        _raiseInterruptedErr(_fn);
+        if (isUser()) {
+            _clearInterrupt(); // Nothing to unwind.
+        }
+        return false;
+    }
+    if (_suspending) {
+        _ym::Global::raiseErr(
+            YmErrCode_CallProcedureError,
+            "Call to {} failed; call stack is suspending!",
+            _fn.fullname());
+        return false;
+    }
     if (!_fn.isCallable()) {
         _ym::Global::raiseErr(
             YmErrCode_NonCallableType,
@@ -1002,17 +1338,30 @@ bool YmCtx::_beginCall(YmType* fn, YmUInt16 args, std::string_view argNames, YmL
     for (YmParams i = 0; i < argPack.dummies(); i++) {
         ymCtx_PutNone(this, YM_PUSH);
     }
+    if (isUser() && _callTimeLimit.count() > 0) {
+        _deadline = std::chrono::steady_clock::now() + _callTimeLimit;
+    }
+    YM_CTX_STAT(stats, Calls, 1);
+    if (_fn.isVarLike()) {
+        YM_CTX_STAT(stats, AccessorCalls, 1);
+    }
     _callStk.push_back(_CallFrame{
         .fn = &_fn,
+        .calledFn = &_fn,
         .argPack = std::move(argPack),
         .returnTo = returnTo,
         .localsOffset = YmUInt32(_globalObjStk.size()),
         });
+    YM_CTX_STAT_PEAK(stats, PeakCallStackHeight, _callStk.size());
     return true;
 }
 
 bool YmCtx::_endCall() noexcept {
     ymAssert(!_callStk.empty());
+    if (_suspending && _callStk.back().fn) {
+        _detachSuspendedFrame();
+        return false;
+    }
     _CallFrame cf = _callStk.back();
     pop(locals());
     _callStk.pop_back();
@@ -1020,11 +1369,22 @@ bool YmCtx::_endCall() noexcept {
         // This is user pseudo-call.
         return true;
     }
+    else if (interrupted()) {
+        // Fail even if call behaviour completed, so interrupts propagate.
+        _raiseInterruptedErr(*cf.fn);
+        YM_CTX_STAT(stats, FailedCalls, 1);
+        pop(cf.dummies());
+        if (cf.returnValue) {
+            release(*cf.returnValue);
+        }
+        return false;
+    }
     else if (!cf.returnValue) {
         _ym::Global::raiseErr(
             YmErrCode_CallProcedureError,
             "Call to {} failed; didn't bind a return value!",
             cf.fn->fullname());
+        YM_CTX_STAT(stats, FailedCalls, 1);
         pop(cf.dummies());
         return false;
     }
@@ -1035,6 +1395,7 @@ bool YmCtx::_endCall() noexcept {
             cf.fn->fullname(),
             cf.returnValue->type->fullname(),
             cf.fn->returnType()->fullname());
+        YM_CTX_STAT(stats, FailedCalls, 1);
         pop(cf.dummies());
         release(*cf.returnValue);
         return false;
@@ -1058,6 +1419,7 @@ void YmCtx::_dispatchCall(YmType* fn) {
         auto forwardedTo = callobj->ptable()[ptableInd];
         cf.fn = forwardedTo;
         cf.fwdFromProto = true;
+        YM_CTX_STAT(stats, ProtocolCalls, 1);
         // If indirectly called method has named params, we gotta add proper number
         // of dummies to cf.argPack, and we gotta push dummy objects for each.
         if (auto named = forwardedTo->namedParams(); named >= 1) {
@@ -1072,6 +1434,101 @@ void YmCtx::_dispatchCall(YmType* fn) {
     callBhvrInfo.fn(this, fn, callBhvrInfo.user);
 }
 
+bool YmCtx::_finishCall() {
+    auto result = _endCall();
+    if (isUser()) {
+        _clearInterrupt(); // Call stack has unwound.
+        if (_suspending) {
+            // Call frames have all been detached into suspension, so release our ref to it.
+            _suspended = true;
+            auto suspension = std::exchange(_suspending, nullptr);
+            ymSuspension_Release(suspension);
+        }
+    }
+    return result;
+}
+
+void YmCtx::_clearInterrupt() noexcept {
+    _interrupt.store(false, std::memory_order_relaxed);
+    _deadline.reset();
+    _memLimitExceeded = false;
+}
+
+void YmCtx::_raiseInterruptedErr(const YmType& fn) {
+    if (_memLimitExceeded) {
+        _ym::Global::raiseErr(
+            YmErrCode_MemLimitExceeded,
+            "Call to {} failed; memory limit ({} bytes) exceeded!",
+            fn.fullname(),
+            _memLimit);
+    }
+    else {
+        _ym::Global::raiseErr(
+            YmErrCode_Interrupted,
+            "Call to {} failed; interrupted!",
+            fn.fullname());
+    }
+}
+
+std::optional<const ym::Safe<YmType>*> YmCtx::_loadPTable(YmType& proto, YmType& boxed) {
+    if (auto result = _ptables.fetch(proto, boxed)) {
+        return result;
+    }
+    // Only activate our load stats (for ptables built) when actually building one, as doing so
+    // isn't free, and conversions are frequent.
+    YM_LOAD_STATS_SCOPE(loader->stats());
+#if defined(YM_CTX_STATS)
+    const size_t built = _ptables.size();
+    auto result = _ptables.load(proto, boxed);
+    YM_CTX_STAT(stats, PTablesBuilt, _ptables.size() - built);
+    return result;
+#else
+    return _ptables.load(proto, boxed);
+#endif
+}
+
+void YmCtx::_detachSuspendedFrame() {
+    ymAssert(_suspending);
+    auto& cf = _callStk.back();
+    const auto begin = _globalObjStk.begin() + (cf.localsOffset - cf.args());
+    _SuspendedFrame frame{
+        .cf = cf,
+        .objs = std::vector<ym::Safe<YmObj>>(begin, _globalObjStk.end()),
+    };
+    frame.cf.localsOffset = cf.args();
+    // Refs are moved into frame, so don't release them.
+    _globalObjStk.erase(begin, _globalObjStk.end());
+    _callStk.pop_back();
+    _suspending->_frames.push_back(std::move(frame));
+}
+
+void YmCtx::_abortCall() noexcept {
+    ymAssert(!isUser());
+    YM_CTX_STAT(stats, FailedCalls, 1);
+    _CallFrame cf = _callStk.back();
+    pop(locals());
+    _callStk.pop_back();
+    pop(cf.dummies());
+    if (cf.returnValue) {
+        release(*cf.returnValue);
+    }
+}
+
+void YmCtx::_discard(YmSuspension& suspension) noexcept {
+    if (suspension._epoch != _epoch) {
+        return; // Its objects were released upon reset.
+    }
+    for (auto& frame : suspension._frames) {
+        for (auto& obj : frame.objs) {
+            release(*obj);
+        }
+        if (frame.cf.returnValue) {
+            release(*frame.cf.returnValue);
+        }
+    }
+    suspension._frames.clear();
+}
+
 std::optional<YmLocal> YmCtx::_absIndex(YmLocal x) const noexcept {
     if (x == YM_PUSH || x == YM_DISCARD) {
         return x;
@@ -1096,6 +1553,98 @@ std::optional<YmLocal> YmCtx::_absIndexForRead(YmLocal x) const noexcept {
     return _absIndex(x);
 }
 
+YmObj* YmCtx::_marshal(YmObj& obj, std::unordered_map<const YmObj*, YmObj*>& visited, bool foreign) {
+    // Copies are created (and added to visited) before their slots are filled in, w/ filling
+    // them in deferred via pending, so objects referenced multiple times (even cyclically) get
+    // copied once, and deep object graphs don't recurse.
+    std::vector<std::pair<const YmObj*, YmObj*>> pending{};
+    auto copyOf = [&](const YmObj& x) -> YmObj* {
+        if (auto it = visited.find(&x); it != visited.end()) {
+            secure(*it->second);
+            return it->second;
+        }
+        if (foreign && !domain->loader->owns(*x.type)) {
+            _ym::Global::raiseErr(
+                YmErrCode_TypeNotFound,
+                "Marshalling failed; {} not found in destination domain!",
+                x.type->fullname());
+            return nullptr;
+        }
+        // Types are shared, but x's type might not have been loaded by us yet.
+        loader->adopt(*x.type);
+        auto result = create(*x.type);
+        visited.try_emplace(&x, result);
+        pending.push_back({ &x, result });
+        return result;
+        };
+    // Upon failure, the copies made so far reference only one another, and some have slots
+    // yet to be filled in, so free them all w/out releasing what they reference.
+    auto fail = [&]() -> YmObj* {
+        for (const auto& [_, copy] : visited) {
+            _free(*copy);
+        }
+        return nullptr;
+        };
+    auto result = copyOf(obj);
+    if (!result) {
+        return fail();
+    }
+    while (!pending.empty()) {
+        auto [from, to] = pending.back();
+        pending.pop_back();
+        if (from->isRegularStruct()) {
+            for (size_t i = 0; i < from->type->info->slots; i++) {
+                auto copy = copyOf(ym::deref(from->slot(i).ref));
+                if (!copy) {
+                    return fail();
+                }
+                to->slot(i).ref = copy;
+            }
+        }
+        else if (from->isProtocol()) {
+            // Ptables are per-context, so we can't share from's.
+            auto& boxed = ym::deref(from->boxed());
+            auto boxedCopy = copyOf(boxed);
+            if (!boxedCopy) {
+                return fail();
+            }
+            auto ptable = _loadPTable(*to->type, *boxed.type);
+            if (!ptable) {
+                _ym::Global::raiseErr(
+                    YmErrCode_IllegalConversion,
+                    "Marshalling failed; cannot box {} into {}!",
+                    boxed.type->fullname(),
+                    to->type->fullname());
+                return fail();
+            }
+            to->box(ym::Safe(boxedCopy), *ptable);
+        }
+        else if (auto type = from->toType()) {
+            if (foreign && !domain->loader->owns(*type)) {
+                _ym::Global::raiseErr(
+                    YmErrCode_TypeNotFound,
+                    "Marshalling failed; {} not found in destination domain!",
+                    type->fullname());
+                return fail();
+            }
+            loader->adopt(*type);
+            to->slot(0) = from->slot(0);
+        }
+        else if (!from->isNone()) { // Other primitives.
+            to->slot(0) = from->slot(0);
+        }
+    }
+    return result;
+}
+
+void YmCtx::_free(YmObj& obj) noexcept {
+    _objects.erase(&obj);
+    YM_CTX_STAT(stats, ObjectsReleased, 1);
+    _mem.dealloc(_ym::ObjHAL::bytes(obj.size()));
+    auto al = mas.allocator<int>();
+    _ym::ObjHAL::destroy(obj, al);
+}
+
 YmRune YmCtx::_uint2rune(YmUInt x) noexcept {
     // TODO: Is there a bitwise trick we can use to avoid modulus?
     return x % 0x110000;
@@ -8,13 +8,18 @@
 #endif
 
 
+#include <atomic>
+#include <chrono>
+#include <optional>
 #include <unordered_map>
 
 #include "../yama/yama.h"
 #include "../yama++/Safe.h"
 #include "ArgPackInfo.h"
+#include "CtxStats.h"
 #include "Loader.h"
 #include "MAS.h"
+#include "MemUsage.h"
 #include "PTableManager.h"
 #include "RefCounter.h"
 #include "YmDm.h"
@@ -28,10 +33,14 @@ public:
 
     const ym::Safe<YmDm> domain;
     const std::shared_ptr<_ym::CtxLoader> loader;
-	_ym::HeapMAS mas; // TODO: Replace later.
+	// The allocator of our objects, or std::nullopt for the default.
+	const std::optional<YmAllocator> allocator;
+	_ym::CtxMAS mas;
+	_ym::CtxStats stats;
 
 
     YmCtx(ym::Safe<YmDm> domain);
+    YmCtx(ym::Safe<YmDm> domain, std::optional<YmAllocator> allocator);
 	~YmCtx() noexcept;
 
 
@@ -45,20 +54,26 @@ public:
 	YmType& ldBool() const noexcept;
 	YmType& ldRune() const noexcept;
 	YmType& ldType() const noexcept;
+	// Returns the primitive kind of type, if it's a primitive type.
+	std::optional<YmPrimitiveKind> primitiveKind(const YmType& type) const noexcept;
 
-	// Creates an uninitialized object of type.
+	// Creates an uninitialized object of type, or returns nullptr if doing so would exceed the
+	// memory limit (interrupting the call in progress.)
 	YmObj* create(YmType& type);
 	YmRefCount secure(YmObj& obj);
 	YmRefCount release(YmObj& obj);
 	void reset();
-
-	ym::Safe<YmObj> newNone();
-	ym::Safe<YmObj> newInt(YmInt v);
-	ym::Safe<YmObj> newUInt(YmUInt v);
-	ym::Safe<YmObj> newFloat(YmFloat v);
-	ym::Safe<YmObj> newBool(YmBool v);
-	ym::Safe<YmObj> newRune(YmRune v);
-	ym::Safe<YmObj> newType(YmType& v);
+	// Discards loaded types (and the ptables built for them), such that types are loaded anew
+	// from our domain, and such that we no longer keep them in use. Call only after reset.
+	void unload() noexcept;
+
+	YmObj* newNone();
+	YmObj* newInt(YmInt v);
+	YmObj* newUInt(YmUInt v);
+	YmObj* newFloat(YmFloat v);
+	YmObj* newBool(YmBool v);
+	YmObj* newRune(YmRune v);
+	YmObj* newType(YmType& v);
 	YmObj* newDefault(YmType* type);
 
 	YmCallStackHeight callStkHeight() const noexcept;
@@ -86,12 +101,39 @@ public:
 	bool getProperty(YmType* propertyType, YmLocal where);
 	bool setProperty(YmType* propertyType);
 	bool convert(YmType& type, YmLocal returnTo);
+	// Thread-safe.
+	void requestInterrupt() noexcept;
+	void setCallTimeLimit(std::chrono::milliseconds limit) noexcept;
+	// Returns if the call in progress has been interrupted, either upon request, or upon exceeding
+	// its time limit.
+	bool interrupted() noexcept;
+	// Writes the memory usage stats of objects of type (or of all objects if type == nullptr) to out.
+	void memUsage(const YmType* type, YmUInt64* out) const noexcept;
+	// Calls are interrupted upon attempting to allocate objects beyond limit bytes, w/ the
+	// allocation failing. 0 means no limit.
+	void setMemLimit(YmUInt64 limit) noexcept;
+	// Returns a JSON snapshot of our objects, grouped by type, and optionally their object graph.
+	std::string heapSnapshot(bool graph) const;
+	// Pushes a deep copy of the object at local in src (which may be us) onto our object stack.
+	bool marshal(YmCtx& src, YmLocal local);
+	// Returns a new suspension (w/ a taken ref) which the call in progress will be detached into
+	// as the call stack unwinds, or nullptr on failure.
+	YmSuspension* suspend();
+	bool resume(YmSuspension& suspension, YmLocal returnTo);
+	bool resumed() const noexcept; // Returns if the call in progress has been resumed.
+	bool suspended() const noexcept; // Returns if the last call from the user call frame suspended.
 
 
 private:
+	friend struct YmSuspension;
+
+
 	struct _CallFrame final {
 		// Fn being called (or nullptr for user call frame.)
 		YmType* fn;
+		// Fn the call was made to, which differs from fn if fwdFromProto (being the method req
+		// forwarded from), and which call behaviours are passed.
+		YmType* calledFn = nullptr;
 		_ym::ArgPackInfo<> argPack;
 		// Where to put return value.
 		YmLocal returnTo;
@@ -103,6 +145,8 @@ private:
 		bool fwdFromProto = false;
 		// The bound return value object.
 		YmObj* returnValue = nullptr;
+		// If this call frame has been resumed (after suspending.)
+		bool resumed = false;
 
 
 		inline YmParams args() const noexcept { return argPack.args(); }
@@ -119,6 +163,13 @@ private:
 		}
 	};
 
+	// A call frame detached from the call stack upon suspension, along w/ its segment of
+	// _globalObjStk (ie. its args, then its locals.)
+	struct _SuspendedFrame final {
+		_CallFrame cf; // localsOffset is relative to the start of objs.
+		std::vector<ym::Safe<YmObj>> objs;
+	};
+
 
 	// TODO: This field is used to ensure all objects are released upon deinit, and
 	//		 should be removed later when a more appropriate way to guarantee this.
@@ -134,16 +185,56 @@ private:
 	_ym::PTableManager _ptables;
 	_ym::VarStorage _vars;
 
+	// Set upon interrupt being requested, or detected (upon exceeding _deadline), and cleared
+	// once the call stack has unwound to the user call frame.
+	// Checking this is cheap, so we can do it for every call.
+	std::atomic_bool _interrupt = false;
+	std::chrono::milliseconds _callTimeLimit{}; // 0 means no time limit.
+	// The deadline of the call (from the user call frame) in progress, if any.
+	std::optional<std::chrono::steady_clock::time_point> _deadline;
+
+	_ym::MemUsage _mem;
+	YmUInt64 _memLimit = 0; // 0 means no limit.
+	// Set upon a call attempting to allocate beyond _memLimit, interrupting it, w/ it being cleared
+	// alongside _interrupt. Only ever accessed by the thread using us, so needn't be atomic.
+	bool _memLimitExceeded = false;
+
+	// The suspension which call frames are detached into as the call stack unwinds, if
+	// suspending, w/ this holding a ref to it.
+	YmSuspension* _suspending = nullptr;
+	bool _suspended = false;
+	// Incremented upon reset, which releases the objects of suspensions, invalidating them.
+	YmUInt64 _epoch = 0;
+
 
 	void _beginUserPseudoCall();
 	bool _beginCall(YmType* fn, YmUInt16 args, std::string_view argNames, YmLocal returnTo);
 	bool _endCall() noexcept;
 	void _dispatchCall(YmType* fn);
+	// Ends the call at the top of the call stack, handling the call stack unwinding to the user
+	// call frame if the call was made from it.
+	bool _finishCall();
+	void _clearInterrupt() noexcept;
+	void _raiseInterruptedErr(const YmType& fn);
+	std::optional<const ym::Safe<YmType>*> _loadPTable(YmType& proto, YmType& boxed);
+	void _detachSuspendedFrame();
+	// Pops the call frame at the top of the call stack w/out returning anything, for calls
+	// failing due to resumed calls they made failing.
+	void _abortCall() noexcept;
+	// Releases the objects of suspension, if it's still valid.
+	void _discard(YmSuspension& suspension) noexcept;
 
 	// Transforms negative indices into positive absolute ones, and fails if out-of-bounds.
 	std::optional<YmLocal> _absIndex(YmLocal x) const noexcept;
 	std::optional<YmLocal> _absIndexForRead(YmLocal x) const noexcept;
 
+	// Returns a copy (w/ a taken ref) of the object graph of obj (of another context), w/ visited
+	// mapping objects already copied to their copies, or nullptr on failure.
+	// If foreign, obj is of a context of another domain, w/ its types needing to be ours too.
+	YmObj* _marshal(YmObj& obj, std::unordered_map<const YmObj*, YmObj*>& visited, bool foreign);
+	// Frees obj w/out releasing the objects it references, for discarding partial copies.
+	void _free(YmObj& obj) noexcept;
+
 	static YmRune _uint2rune(YmUInt x) noexcept;
 };
 
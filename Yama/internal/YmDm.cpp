@@ -2,12 +2,24 @@
 
 #include "YmDm.h"
 
+#include <chrono>
+
 #include "general.h"
+#include "YmCtx.h"
 #include "YmParcelDef.h"
 
 
-YmDm::YmDm() :
-    loader(std::make_shared<_ym::DmLoader>()) {}
+YmDm::YmDm(std::optional<YmAllocator> allocator) :
+    loader(std::make_shared<_ym::DmLoader>()),
+    allocator(allocator) {}
+
+YmDm::~YmDm() noexcept {
+    // Don't let preload threads outlive the domain.
+    (void)waitPreload();
+    for (const auto& ctx : _ctxPool) {
+        delete ctx;
+    }
+}
 
 bool YmDm::bindParcelDef(const std::string& path, ym::Safe<YmParcelDef> parceldef) {
     return loader->bindParcelDef(path, parceldef);
@@ -21,3 +33,139 @@ size_t YmDm::forEachParcel(YmForEachParcelCallbackFn callback, void* user) {
     return loader->forEachParcel(callback, user, this);
 }
 
+bool YmDm::preloadAsync(std::span<const YmFullname> fullnames) {
+    // Parse fullnames up-front so syntax errors get reported on the calling thread.
+    std::vector<_ym::Spec> specs{};
+    specs.reserve(fullnames.size());
+    for (const auto& fullname : fullnames) {
+        if (auto s = _ym::Spec::type(std::string(ym::Safe(fullname)))) {
+            specs.push_back(std::move(*s));
+        }
+        else {
+            _ym::Global::raiseErr(
+                YmErrCode_IllegalSpecifier,
+                "Preload failed; \"{}\" syntax error!",
+                fullname);
+            return false;
+        }
+    }
+    // Load errors get reported via the err callback of the thread which requested the preload.
+    auto errCallback = _ym::Global::errCallback();
+    auto task =
+        [loader = loader, specs = std::move(specs), errCallback]() -> bool {
+        _ym::Global::setErrCallback(errCallback.fn, errCallback.user);
+        bool success = true;
+        for (const auto& fullname : specs) {
+            if (!loader->load(fullname)) {
+                success = false;
+            }
+        }
+        return success;
+        };
+    std::scoped_lock lk(_preloadsLock);
+    _preloads.push_back(std::async(std::launch::async, std::move(task)));
+    return true;
+}
+
+bool YmDm::preloadDone() {
+    std::scoped_lock lk(_preloadsLock);
+    for (const auto& preload : _preloads) {
+        if (preload.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool YmDm::waitPreload() {
+    std::vector<std::future<bool>> preloads{};
+    {
+        std::scoped_lock lk(_preloadsLock);
+        std::swap(preloads, _preloads);
+    }
+    bool success = true;
+    for (auto& preload : preloads) {
+        if (!preload.get()) {
+            success = false;
+        }
+    }
+    return success;
+}
+
+size_t YmDm::collectTypes() {
+    return loader->collect();
+}
+
+bool YmDm::saveImage(const std::string& path) {
+    _ym::ImageWriter w(_ym::ImageKind::Dm);
+    loader->writeImage(w);
+    if (!_ym::writeImageFile(path, w.data())) {
+        _ym::Global::raiseErr(
+            YmErrCode_ImageError,
+            "Cannot save image; failed to write file \"{}\"!",
+            path);
+        return false;
+    }
+    return true;
+}
+
+bool YmDm::loadImage(const std::string& path, YmRelinkCallBhvrCallbackFn relink, void* user) {
+    const auto data = _ym::readImageFile(path);
+    if (!data) {
+        _ym::Global::raiseErr(
+            YmErrCode_ImageError,
+            "Cannot load image; failed to read file \"{}\"!",
+            path);
+        return false;
+    }
+    _ym::ImageReader r(*data);
+    if (!r.header(_ym::ImageKind::Dm)) {
+        _ym::Global::raiseErr(
+            YmErrCode_ImageError,
+            "Cannot load image; \"{}\" is not a domain image, or is of an incompatible version!",
+            path);
+        return false;
+    }
+    return loader->readImage(r, relink, user);
+}
+
+ym::Safe<YmCtx> YmDm::acquireCtx() {
+    YmCtx* result = nullptr;
+    {
+        std::scoped_lock lk(_ctxPoolLock);
+        if (!_ctxPool.empty()) {
+            result = _ctxPool.back();
+            _ctxPool.pop_back();
+        }
+    }
+    if (!result) {
+        result = new YmCtx(ym::Safe(this));
+    }
+    result->refs.addRef();
+    return ym::Safe(result);
+}
+
+void YmDm::returnCtx(ym::Safe<YmCtx> ctx) {
+    ymAssert(ctx->domain.get() == this);
+    ymAssert(ctx->refs.count() == 0);
+    if (!_ym::sameAllocator(ctx->allocator, allocator)) {
+        delete ctx.get(); // Pool only contexts interchangeable w/ those acquireCtx creates.
+        return;
+    }
+    // Loaded types are dropped, so pooled contexts don't keep them in use (ie. preventing them
+    // from being collected), and so they don't resolve stale types after rebinds/redirects.
+    ctx->reset();
+    ctx->unload();
+    ctx->loader->stats().reset();
+    ctx->stats.reset();
+    ctx->setCallTimeLimit({});
+    ctx->setMemLimit(0);
+    {
+        std::scoped_lock lk(_ctxPoolLock);
+        if (_ctxPool.size() < _maxPooledCtxs) {
+            _ctxPool.push_back(ctx);
+            return;
+        }
+    }
+    delete ctx.get();
+}
@@ -8,7 +8,12 @@
 #endif
 
 
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
 
 #include "../yama/yama.h"
 #include "../yama++/Safe.h"
@@ -22,15 +27,43 @@ public:
     _ym::AtomicRefCounter<YmRefCount> refs;
 
     const std::shared_ptr<_ym::DmLoader> loader;
+    // The allocator of contexts created w/out specifying one, or std::nullopt for the default.
+    const std::optional<YmAllocator> allocator;
 
 
-    YmDm();
+    YmDm(std::optional<YmAllocator> allocator = std::nullopt);
+    ~YmDm() noexcept;
 
 
-    // TODO: Maybe add string interning later.
-
     bool bindParcelDef(const std::string& path, ym::Safe<YmParcelDef> parceldef);
     bool addRedirect(const std::string& subject, const std::string& before, const std::string& after);
     size_t forEachParcel(YmForEachParcelCallbackFn callback, void* user);
+
+    bool preloadAsync(std::span<const YmFullname> fullnames);
+    bool preloadDone();
+    bool waitPreload();
+
+    size_t collectTypes();
+
+    bool saveImage(const std::string& path);
+    bool loadImage(const std::string& path, YmRelinkCallBhvrCallbackFn relink, void* user);
+
+    // Returns a context from the pool, or a new one if the pool is empty.
+    // The returned context has a ref count of 1.
+    ym::Safe<YmCtx> acquireCtx();
+    // Resets ctx (which must have a ref count of 0), and returns it to the pool, or destroys it
+    // if the pool is full, or if ctx doesn't use allocator.
+    void returnCtx(ym::Safe<YmCtx> ctx);
+
+
+private:
+    // Contexts past this are destroyed rather than pooled, so bursts don't pin memory forever.
+    static constexpr size_t _maxPooledCtxs = 64;
+
+    std::mutex _ctxPoolLock; // Protects _ctxPool.
+    std::vector<YmCtx*> _ctxPool; // Owned by us.
+
+    std::mutex _preloadsLock; // Protects _preloads.
+    std::vector<std::future<bool>> _preloads; // Each future yields if all of its loads succeeded.
 };
 
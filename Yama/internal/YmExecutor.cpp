@@ -0,0 +1,222 @@
+#include "YmExecutor.h"
+
+#include <algorithm>
+
+#include "SpecSolver.h"
+#include "YmCtx.h"
+#include "YmDm.h"
+#include "YmObj.h"
+
+
+namespace {
+    // Index of the worker running on this thread, if any, and the executor it belongs to, so
+    // jobs submitted by workers get queued on their own queues.
+    thread_local const YmExecutor* workerOf = nullptr;
+    thread_local size_t workerIndex = 0;
+}
+
+
+YmExecutor::YmExecutor(ym::Safe<YmDm> domain, size_t workers) :
+    domain(domain) {
+    if (workers == 0) {
+        workers = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    ymDm_Secure(domain);
+    _queues.reserve(workers);
+    for (size_t i = 0; i < workers; i++) {
+        _queues.push_back(std::make_unique<_Queue>());
+    }
+    _workers.reserve(workers);
+    for (size_t i = 0; i < workers; i++) {
+        _workers.emplace_back([this, i](std::stop_token stop) { _workerMain(i, stop); });
+    }
+}
+
+YmExecutor::~YmExecutor() noexcept {
+    ymAssert(workerOf != this); // Would deadlock in wait, and have the worker join itself.
+    wait();
+    for (auto& worker : _workers) {
+        worker.request_stop();
+    }
+    for (auto& queue : _queues) {
+        queue->wakeup.release(); // Wake sleeping workers so they see the stop request.
+    }
+    _workers.clear(); // Joins workers.
+    ymDm_Release(domain);
+}
+
+size_t YmExecutor::workers() const noexcept {
+    return _queues.size();
+}
+
+bool YmExecutor::submit(
+    const std::string& fn,
+    std::span<const YmPrimitive> args,
+    std::string argNames,
+    YmExecutorCallbackFn callback,
+    void* user) {
+    // Parse fn up-front so syntax errors get reported on the calling thread.
+    if (!_ym::Spec::type(fn)) {
+        _ym::Global::raiseErr(
+            YmErrCode_IllegalSpecifier,
+            "Cannot submit job; \"{}\" syntax error!",
+            fn);
+        return false;
+    }
+    const size_t queue =
+        workerOf == this
+        ? workerIndex
+        : _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+    // Count the job as pending before it can be claimed, so it can't finish (and decrement
+    // _pending) before being counted.
+    _pending.fetch_add(1);
+    {
+        std::scoped_lock lk(_queues[queue]->lock);
+        _queues[queue]->jobs.push_back(_Job{
+            .fn = fn,
+            .args = std::vector<YmPrimitive>(args.begin(), args.end()),
+            .argNames = std::move(argNames),
+            .callback = callback,
+            .user = user,
+            .errCallback = _ym::Global::errCallback(),
+            });
+        _queued.fetch_add(1);
+    }
+    // Wake the worker of the queue we pushed to, or if it's busy, another to steal the job.
+    if (!_wake(*_queues[queue])) {
+        for (size_t i = 1; i < _queues.size(); i++) {
+            if (_wake(*_queues[(queue + i) % _queues.size()])) {
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+void YmExecutor::wait() {
+    ymAssert(workerOf != this); // Would wait on its own job forever.
+    for (size_t n = _pending.load(); n > 0; n = _pending.load()) {
+        _pending.wait(n);
+    }
+}
+
+void YmExecutor::_workerMain(size_t index, std::stop_token stop) {
+    workerOf = this;
+    workerIndex = index;
+    auto ctx = domain->acquireCtx();
+    _Job job{};
+    while (!stop.stop_requested()) {
+        if (!_tryClaim(index, job)) {
+            _sleep(*_queues[index]);
+            continue;
+        }
+        _perform(*ctx, job);
+        // Notify after performing, so jobs (and their callbacks) have finished by the time
+        // wait returns.
+        if (_pending.fetch_sub(1) == 1) {
+            _pending.notify_all();
+        }
+    }
+    ymCtx_ReturnToPool(ctx);
+}
+
+bool YmExecutor::_tryClaim(size_t index, _Job& out) {
+    if (_queued.load() == 0) {
+        return false;
+    }
+    for (size_t i = 0; i < _queues.size(); i++) {
+        auto& queue = *_queues[(index + i) % _queues.size()];
+        std::scoped_lock lk(queue.lock);
+        if (queue.jobs.empty()) {
+            continue;
+        }
+        // Pop our own jobs from the front, and steal others' from the back.
+        const bool own = i == 0;
+        out = std::move(own ? queue.jobs.front() : queue.jobs.back());
+        if (own) {
+            queue.jobs.pop_front();
+        }
+        else {
+            queue.jobs.pop_back();
+        }
+        _queued.fetch_sub(1);
+        return true;
+    }
+    return false;
+}
+
+void YmExecutor::_sleep(_Queue& queue) {
+    queue.sleeping.store(true);
+    // Submitters bump _queued before checking if we're sleeping, and we set sleeping before
+    // checking _queued, so (these being seq_cst) either we see the job, or they see us sleeping.
+    if (_queued.load() > 0) {
+        if (queue.sleeping.exchange(false)) {
+            return; // Not woken, so don't sleep.
+        }
+        // Woken by a submitter in the meantime, so consume their release.
+    }
+    queue.wakeup.acquire();
+}
+
+bool YmExecutor::_wake(_Queue& queue) noexcept {
+    if (!queue.sleeping.exchange(false)) {
+        return false;
+    }
+    queue.wakeup.release();
+    return true;
+}
+
+void YmExecutor::_perform(YmCtx& ctx, const _Job& job) {
+    _ym::Global::setErrCallback(job.errCallback.fn, job.errCallback.user);
+    std::optional<YmPrimitive> result{};
+    bool succeeded = [&]() -> bool {
+        auto fn = ymCtx_Load(&ctx, job.fn.c_str());
+        if (!fn) {
+            return false;
+        }
+        for (const auto& arg : job.args) {
+            if (!_put(ctx, arg)) {
+                return false;
+            }
+        }
+        if (!ymCtx_Call(&ctx, fn, YmUInt16(job.args.size()), job.argNames.c_str(), YM_PUSH)) {
+            return false;
+        }
+        result = _toPrimitive(ctx, ym::deref(ymCtx_Local(&ctx, -1, YM_BORROW)));
+        return true;
+        }();
+    if (job.callback) {
+        job.callback(job.user, succeeded, result ? &*result : nullptr);
+    }
+    // Don't let objects (or var values) carry over to the next job.
+    ctx.reset();
+}
+
+bool YmExecutor::_put(YmCtx& ctx, const YmPrimitive& x) {
+    static_assert(YmPrimitiveKind_Num == 7);
+    switch (x.kind) {
+    case YmPrimitiveKind_None:  return ymCtx_PutNone(&ctx, YM_PUSH);
+    case YmPrimitiveKind_Int:   return ymCtx_PutInt(&ctx, YM_PUSH, x.i);
+    case YmPrimitiveKind_UInt:  return ymCtx_PutUInt(&ctx, YM_PUSH, x.ui);
+    case YmPrimitiveKind_Float: return ymCtx_PutFloat(&ctx, YM_PUSH, x.f);
+    case YmPrimitiveKind_Bool:  return ymCtx_PutBool(&ctx, YM_PUSH, x.b);
+    case YmPrimitiveKind_Rune:  return ymCtx_PutRune(&ctx, YM_PUSH, x.r);
+    case YmPrimitiveKind_Type:  return ymCtx_PutType(&ctx, YM_PUSH, x.type);
+    default:                    YM_DEADEND; return false;
+    }
+}
+
+std::optional<YmPrimitive> YmExecutor::_toPrimitive(YmCtx& ctx, YmObj& x) {
+    YmPrimitive result{};
+    const auto type = ymObj_Type(&x);
+    if (type == &ctx.ldNone())          result.kind = YmPrimitiveKind_None;
+    else if (type == &ctx.ldInt())      result = YmPrimitive{ .kind = YmPrimitiveKind_Int, .i = ymObj_ToInt(&x, nullptr) };
+    else if (type == &ctx.ldUInt())     result = YmPrimitive{ .kind = YmPrimitiveKind_UInt, .ui = ymObj_ToUInt(&x, nullptr) };
+    else if (type == &ctx.ldFloat())    result = YmPrimitive{ .kind = YmPrimitiveKind_Float, .f = ymObj_ToFloat(&x, nullptr) };
+    else if (type == &ctx.ldBool())     result = YmPrimitive{ .kind = YmPrimitiveKind_Bool, .b = ymObj_ToBool(&x, nullptr) };
+    else if (type == &ctx.ldRune())     result = YmPrimitive{ .kind = YmPrimitiveKind_Rune, .r = ymObj_ToRune(&x, nullptr) };
+    else if (type == &ctx.ldType())     result = YmPrimitive{ .kind = YmPrimitiveKind_Type, .type = ymObj_ToType(&x, nullptr) };
+    else                                return std::nullopt;
+    return result;
+}
+
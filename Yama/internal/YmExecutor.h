@@ -0,0 +1,99 @@
+
+
+#pragma once
+
+
+#ifdef _YM_FORBID_INCLUDE_IN_YAMA_DOT_H
+#error Not allowed to expose this header file to header file yama.h!
+#endif
+
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <semaphore>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../yama/yama.h"
+#include "../yama++/Safe.h"
+#include "general.h"
+#include "RefCounter.h"
+
+
+struct YmExecutor final {
+public:
+    // refs is not managed internally by this class.
+    _ym::AtomicRefCounter<YmRefCount> refs;
+
+    const ym::Safe<YmDm> domain;
+
+
+    // workers == 0 specifies a worker per hardware thread.
+    YmExecutor(ym::Safe<YmDm> domain, size_t workers);
+    // Must not be called on one of our workers (ie. by a job callback releasing us.)
+    ~YmExecutor() noexcept;
+
+
+    size_t workers() const noexcept;
+
+    bool submit(
+        const std::string& fn,
+        std::span<const YmPrimitive> args,
+        std::string argNames,
+        YmExecutorCallbackFn callback,
+        void* user);
+    // Must not be called on one of our workers (ie. by a job callback), as it'd wait on its own job.
+    void wait();
+
+
+private:
+    struct _Job final {
+        std::string fn;
+        std::vector<YmPrimitive> args;
+        std::string argNames;
+        YmExecutorCallbackFn callback;
+        void* user;
+        _ym::ErrCallbackInfo errCallback; // Of the submitting thread.
+    };
+    // Each worker has a queue of its own, which it pops jobs from the front of, w/ other workers
+    // stealing from the back of it when their own queues are empty.
+    // Workers sleep on a semaphore of their own, so submitters wake a specific worker (ie. the
+    // one whose queue they pushed to, or another to steal the job if it's busy), rather than
+    // all of them contending for a shared lock.
+    struct _Queue final {
+        std::mutex lock; // Protects jobs.
+        std::deque<_Job> jobs;
+        std::atomic_bool sleeping = false; // Set by the worker before sleeping, and cleared by whoever wakes it.
+        std::counting_semaphore<> wakeup{ 0 };
+    };
+
+
+    std::vector<std::unique_ptr<_Queue>> _queues;
+    std::atomic<size_t> _nextQueue = 0; // Round-robin index of queue to submit to.
+    // Jobs in queues, changed alongside pushes/pops (under the queue's lock), so workers can tell
+    // if there's anything to claim before sleeping.
+    std::atomic<size_t> _queued = 0;
+    std::atomic<size_t> _pending = 0; // Jobs submitted but not yet performed (waited on by wait.)
+    std::vector<std::jthread> _workers; // Declared last, so they're joined before the rest of us is destroyed.
+
+
+    void _workerMain(size_t index, std::stop_token stop);
+    // Claims a job (from our queue, or stolen from another), returning if one was claimed.
+    bool _tryClaim(size_t index, _Job& out);
+    // Sleeps until woken (ie. upon a job being submitted, or stop being requested), unless there
+    // are jobs to claim.
+    void _sleep(_Queue& queue);
+    // Wakes the worker of queue if it's sleeping, returning if it was.
+    static bool _wake(_Queue& queue) noexcept;
+    // Performs job in ctx, calling its callback.
+    void _perform(YmCtx& ctx, const _Job& job);
+    static bool _put(YmCtx& ctx, const YmPrimitive& x);
+    static std::optional<YmPrimitive> _toPrimitive(YmCtx& ctx, YmObj& x);
+};
+
@@ -12,11 +12,11 @@ size_t YmParcel::types() const noexcept {
     return info->types();
 }
 
-const _ym::TypeInfo* YmParcel::type(const std::string& localName) const noexcept {
+const _ym::TypeInfo* YmParcel::type(std::string_view localName) const noexcept {
     return info->type(localName);
 }
 
-void YmParcel::resolveRedirects(_ym::Redirects& state) {
+void YmParcel::resolveRedirects(const _ym::Redirects& state) {
     redirects = state.compute(path);
 }
 
@@ -6,6 +6,7 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "../yama/yama.h"
 #include "../yama++/general.h"
@@ -21,14 +22,14 @@ public:
 
     const Name path;
     const std::shared_ptr<_ym::ParcelInfo> info;
-    std::optional<_ym::RedirectSet> redirects;
+    std::shared_ptr<const _ym::RedirectSet> redirects; // nullptr if no redirects apply to us.
 
 
     YmParcel(_ym::Spec path, std::shared_ptr<_ym::ParcelInfo> info);
 
 
     size_t types() const noexcept;
-    const _ym::TypeInfo* type(const std::string& localName) const noexcept;
+    const _ym::TypeInfo* type(std::string_view localName) const noexcept;
 
     inline const Name& getName() const noexcept { return path; }
 
@@ -38,6 +39,6 @@ public:
     //       later import of the binding succeeds, resulting in the first result value becoming
     //       stale.
 
-    void resolveRedirects(_ym::Redirects& state);
+    void resolveRedirects(const _ym::Redirects& state);
 };
 
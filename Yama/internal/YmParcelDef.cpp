@@ -9,6 +9,46 @@ bool YmParcelDef::verify() const {
     return info->verify();
 }
 
+std::optional<std::string> YmParcelDef::serialize() const {
+    if (!verify()) {
+        return std::nullopt;
+    }
+    _ym::ImageWriter w(_ym::ImageKind::ParcelDef);
+    info->write(w);
+    return w.data();
+}
+
+std::unique_ptr<YmParcelDef> YmParcelDef::deserialize(std::string_view data, YmRelinkCallBhvrCallbackFn relink, void* user) {
+    static constexpr std::string_view msg = "Cannot deserialize parcel def.";
+    _ym::ImageReader r(data);
+    if (!r.header(_ym::ImageKind::ParcelDef)) {
+        _ym::Global::raiseErr(
+            YmErrCode_ImageError,
+            "{}; data is not a serialized parcel def., or is of an incompatible version!",
+            (std::string)msg);
+        return nullptr;
+    }
+    auto relinker = [&](const _ym::TypeInfo& type) -> std::optional<_ym::CallBhvrCallbackInfo> {
+        _ym::CallBhvrCallbackInfo result{};
+        return
+            relink && relink(user, nullptr, type.localName().c_str(), &result.fn, &result.user) && result.fn
+            ? std::make_optional(result)
+            : std::nullopt;
+        };
+    auto result = _ym::ParcelInfo::read(r, relinker, msg);
+    if (!result) {
+        return nullptr;
+    }
+    if (!r.done()) {
+        _ym::Global::raiseErr(
+            YmErrCode_ImageError,
+            "{}; data is malformed!",
+            (std::string)msg);
+        return nullptr;
+    }
+    return std::make_unique<YmParcelDef>(std::move(result));
+}
+
 bool YmParcelDef::addStruct(
     const std::string& name,
     _ym::KindEx k) {
@@ -205,9 +245,9 @@ std::optional<YmParamIndex> YmParcelDef::addParam(
         std::move(paramTypeSymbol));
 }
 
-void YmParcelDef::beginNamedParams(
+bool YmParcelDef::beginNamedParams(
     const std::string& typeName) {
-    info->beginNamedParams(typeName);
+    return info->beginNamedParams(typeName);
 }
 
 std::optional<YmRef> YmParcelDef::addRef(
@@ -218,6 +258,17 @@ std::optional<YmRef> YmParcelDef::addRef(
         std::move(symbol));
 }
 
+size_t YmParcelDef::addBulk(std::span<const YmTypeDesc> descs) {
+    // Most descs add a single type, so reserving up-front spares us most rehashing/reallocation.
+    info->reserve(info->types() + descs.size());
+    for (size_t i = 0; i < descs.size(); i++) {
+        if (!_addDesc(descs[i])) {
+            return i;
+        }
+    }
+    return descs.size();
+}
+
 bool YmParcelDef::_addReadOnlyVar(
     const std::string& name,
     std::string typeSymbol,
@@ -327,3 +378,61 @@ bool YmParcelDef::_addProperty(
     return false;
 }
 
+bool YmParcelDef::_addDesc(const YmTypeDesc& desc) {
+    auto str = [](const YmChar* x) { return std::string(ym::Safe(x)); };
+    const auto name = str(desc.name);
+    const auto bhvr = _ym::CallBhvrCallbackInfo::mk(desc.behaviour, desc.behaviourData);
+    const auto setBhvr = _ym::CallBhvrCallbackInfo::mk(desc.setBehaviour, desc.setBehaviourData);
+    static_assert(YmTypeDescKind_Num == 13);
+    // Member kinds come last.
+    const bool isMember = desc.kind >= YmTypeDescKind_Method;
+    const bool success = [&]() -> bool {
+        switch (desc.kind) {
+        case YmTypeDescKind_Struct:                     return addStruct(name);
+        case YmTypeDescKind_Protocol:                   return addProtocol(name);
+        case YmTypeDescKind_Fn:                         return addFn(name, str(desc.type), bhvr);
+        case YmTypeDescKind_ReadOnlyStoredVar:          return addReadOnlyStoredVar(name, str(desc.type), bhvr);
+        case YmTypeDescKind_StoredVar:                  return addStoredVar(name, str(desc.type), bhvr);
+        case YmTypeDescKind_ReadOnlyComputedVar:        return addReadOnlyComputedVar(name, str(desc.type), bhvr);
+        case YmTypeDescKind_ComputedVar:                return addComputedVar(name, str(desc.type), bhvr, setBhvr);
+        case YmTypeDescKind_Method:                     return addMethod(str(desc.ownerName), name, str(desc.type), bhvr);
+        case YmTypeDescKind_MethodReq:                  return addMethodReq(str(desc.ownerName), name, str(desc.type));
+        case YmTypeDescKind_ReadOnlyStoredProperty:     return addReadOnlyStoredProperty(str(desc.ownerName), name, str(desc.type));
+        case YmTypeDescKind_StoredProperty:             return addStoredProperty(str(desc.ownerName), name, str(desc.type));
+        case YmTypeDescKind_ReadOnlyComputedProperty:   return addReadOnlyComputedProperty(str(desc.ownerName), name, str(desc.type), bhvr);
+        case YmTypeDescKind_ComputedProperty:           return addComputedProperty(str(desc.ownerName), name, str(desc.type), bhvr, setBhvr);
+        default:                                        YM_DEADEND; return false;
+        }
+        }();
+    if (!success) {
+        return false;
+    }
+    const auto localName =
+        isMember
+        ? std::format("{}::{}", desc.ownerName, name)
+        : name;
+    for (size_t i = 0; i < desc.typeParamsN; i++) {
+        if (!addTypeParam(localName, str(desc.typeParams[i].name), str(desc.typeParams[i].type))) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < desc.paramsN; i++) {
+        if (!addParam(localName, str(desc.params[i].name), str(desc.params[i].type))) {
+            return false;
+        }
+    }
+    if (desc.namedParamsN >= 1 && !beginNamedParams(localName)) {
+        return false;
+    }
+    for (size_t i = 0; i < desc.namedParamsN; i++) {
+        if (!addParam(localName, str(desc.namedParams[i].name), str(desc.namedParams[i].type))) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < desc.refsN; i++) {
+        if (!addRef(localName, str(desc.refs[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -10,7 +10,9 @@
 
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include "../yama/yama.h"
 #include "general.h"
@@ -29,10 +31,19 @@ public:
     inline YmParcelDef() :
         info(std::make_shared<_ym::ParcelInfo>()) {
     }
+    inline explicit YmParcelDef(std::shared_ptr<_ym::ParcelInfo> info) :
+        info(std::move(info)) {
+    }
 
 
     bool verify() const;
 
+    // Returns the serialized parcel def, or std::nullopt if it fails verification.
+    std::optional<std::string> serialize() const;
+    // Returns the parcel def serialized in data, or nullptr on failure.
+    // The returned parcel def has a ref count of 0.
+    static std::unique_ptr<YmParcelDef> deserialize(std::string_view data, YmRelinkCallBhvrCallbackFn relink, void* user);
+
     bool addStruct(
         const std::string& name,
         _ym::KindEx k = _ym::KindEx::Struct);
@@ -96,12 +107,15 @@ public:
         std::string typeName,
         std::string name,
         std::string paramTypeSymbol);
-    void beginNamedParams(
+    bool beginNamedParams(
         const std::string& typeName);
     std::optional<YmRef> addRef(
         std::string typeName,
         std::string symbol);
 
+    // Returns the number of descs added, stopping at the first which fails.
+    size_t addBulk(std::span<const YmTypeDesc> descs);
+
 
 private:
     bool _addReadOnlyVar(
@@ -138,5 +152,6 @@ private:
         _ym::CallBhvrCallbackInfo setBehaviour,
         _ym::KindEx getK,
         _ym::KindEx setK);
+    bool _addDesc(const YmTypeDesc& desc);
 };
 
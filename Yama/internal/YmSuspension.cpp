@@ -0,0 +1,18 @@
+#include "YmSuspension.h"
+
+
+YmSuspension::YmSuspension(ym::Safe<YmCtx> ctx) :
+    ctx(ctx),
+    _epoch(ctx->_epoch) {
+    ymCtx_Secure(ctx);
+}
+
+YmSuspension::~YmSuspension() noexcept {
+    ctx->_discard(*this);
+    ymCtx_Release(ctx);
+}
+
+bool YmSuspension::resumable() const noexcept {
+    return _epoch == ctx->_epoch && !_frames.empty();
+}
+
@@ -0,0 +1,45 @@
+
+
+#pragma once
+
+
+#ifdef _YM_FORBID_INCLUDE_IN_YAMA_DOT_H
+#error Not allowed to expose this header file to header file yama.h!
+#endif
+
+
+#include <vector>
+
+#include "../yama/yama.h"
+#include "../yama++/Safe.h"
+#include "RefCounter.h"
+#include "YmCtx.h"
+
+
+struct YmSuspension final {
+public:
+    // refs is not managed internally by this class.
+    _ym::RefCounter<YmRefCount> refs;
+
+    const ym::Safe<YmCtx> ctx;
+
+
+    // Holds a ref to ctx for as long as the suspension exists.
+    YmSuspension(ym::Safe<YmCtx> ctx);
+    ~YmSuspension() noexcept;
+
+
+    // Returns if the suspension can be resumed (ie. if the call has been detached into it, and
+    // has not yet been resumed, and ctx hasn't been reset since.)
+    bool resumable() const noexcept;
+
+
+private:
+    friend struct YmCtx;
+
+
+    const YmUInt64 _epoch;
+    // Innermost call frame first.
+    std::vector<YmCtx::_SuspendedFrame> _frames;
+};
+
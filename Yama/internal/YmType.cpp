@@ -21,8 +21,9 @@ const _ym::Spec& YmType::path() const noexcept {
     return parcel->path;
 }
 
-const _ym::Spec& YmType::fullname() const noexcept {
-    return _fullname;
+const _ym::Spec& YmType::fullname() const {
+    std::call_once(_fullnameFlag, [this]() { _fullname = _genFullname(); });
+    return *_fullname;
 }
 
 const std::string& YmType::localName() const noexcept {
@@ -204,20 +205,7 @@ bool YmType::isObjMethod() const noexcept {
 }
 
 std::optional<std::string> YmType::callsuff() const {
-    if (!info->hasCallSig()) {
-        return std::nullopt;
-    }
-    std::string result{};
-    result += "(";
-    for (YmParams i = 0; i < positionalParams(); i++) {
-        if (i >= 1) {
-            result += ", ";
-        }
-        result += param(i)->type().fullname().string();
-    }
-    result += ") -> ";
-    result += returnType()->fullname().string();
-    return ym::retopt(result);
+    return _lazyCallSuff();
 }
 
 std::optional<_ym::Spec> YmType::callsig() const {
@@ -228,8 +216,7 @@ std::optional<_ym::Spec> YmType::callsig() const {
 }
 
 bool YmType::checkCallSuff(std::string_view callsuff) const {
-    // TODO: A heap allocation being needed here is suboptimal.
-    auto ours = this->callsuff();
+    const auto& ours = _lazyCallSuff();
     return
         ours
         ? *ours == callsuff
@@ -285,7 +272,7 @@ std::optional<YmType::TypeParam> YmType::typeParam(YmTypeParamIndex index) const
     return _mkHelper<TypeParam>(self()->info->typeParam(index));
 }
 
-std::optional<YmType::TypeParam> YmType::typeParam(const std::string& name) const noexcept {
+std::optional<YmType::TypeParam> YmType::typeParam(std::string_view name) const noexcept {
     // Can't forget the 'self()->' part!
     return _mkHelper<TypeParam>(self()->info->typeParam(name));
 }
@@ -298,10 +285,35 @@ std::optional<YmType::Member> YmType::member(YmMemberIndex index) const noexcept
     return _mkHelper<Member>(info->member(index));
 }
 
-std::optional<YmType::Member> YmType::member(const std::string& name) const noexcept {
+std::optional<YmType::Member> YmType::member(std::string_view name) const noexcept {
     return _mkHelper<Member>(info->member(name));
 }
 
+YmType* YmType::memberType(YmMemberIndex index) const {
+    if (const auto result = tryMemberType(index)) {
+        return result;
+    }
+    // NOTE: Const-ness here is that of the accessor, w/ materialization not changing
+    //       anything observable about us (see TODO at top of YmType.h.)
+    return ym::deref(_materializer).materializeMember(const_cast<YmType&>(*this), index);
+}
+
+YmType* YmType::tryMemberType(YmMemberIndex index) const noexcept {
+    ymAssert(index < members());
+    return _memberTypes[index].load(std::memory_order_acquire);
+}
+
+void YmType::publishMember(YmMemberIndex index, YmType& member) const noexcept {
+    ymAssert(index < members());
+    ymAssert(member.owner() == this);
+    _memberTypes[index].store(&member, std::memory_order_release);
+}
+
+void YmType::addMemberDep(YmType& dep) {
+    ymAssert(isOwner());
+    _memberDeps.push_back(dep);
+}
+
 YmType* YmType::returnType() const noexcept {
     return constAsRef(info->returnTypeConst());
 }
@@ -346,6 +358,11 @@ YmType* YmType::ref(YmRef reference) const noexcept {
 }
 
 bool YmType::depends(ym::Safe<YmType> other) const noexcept {
+    // Owners depend upon their members via their '$Self::[MEMBER]' consts, but these
+    // consts may not be resolved (see memberType.)
+    if (other->owner() == this) {
+        return true;
+    }
     for (auto& c : consts()) {
         if (_ym::constTypeOf(c) != _ym::ConstType::Ref) continue;
         if (c.as<ym::Safe<YmType>>() != other) continue;
@@ -390,49 +407,56 @@ bool YmType::conforms(ym::Safe<YmType> protocol) const noexcept {
         }
         };
     // Check for each member req in protocol.
-    for (YmMemberIndex i = 0; i < protocol->members(); i++) {
-        auto& pMemb = ym::deref(protocol->member(i));
+    const bool result = forEachConformanceMatch(*protocol, [&](const Member& pMemb, const std::optional<Member>& match) -> bool {
 #if _DUMP_CONFORMS_LOG
         ym::println("YmType::conforms: Matching \"{}\".", pMemb.info->memberName());
 #endif
         // Check that a matching type can be found for each member req in protocol.
-        if (auto match = member(pMemb.name())) {
+        if (!match) {
 #if _DUMP_CONFORMS_LOG
-            ym::println("YmType::conforms: Return Types:");
+            ym::println("YmType::conforms: Match not found!", pMemb.info->memberName());
 #endif
-            // Check return types.
-            if (!compare(
-                pMemb.type(),
-                pMemb.type().info->returnTypeConst().value(),
-                match->type(),
-                ym::deref(match->type().returnType()))) {
-                return false;
-            }
+            return false;
+        }
+        const auto pMembType = pMemb.type();
+        const auto matchType = match->type();
+        // Fail if either failed to materialize.
+        if (!pMembType || !matchType) {
+            return false;
+        }
 #if _DUMP_CONFORMS_LOG
-            ym::println("YmType::conforms: Positional Param Count: {} vs. {}", match->params(), pMemb.params());
-            ym::println("YmType::conforms: Positional Params:");
+        ym::println("YmType::conforms: Return Types:");
 #endif
-            // Check positional param counts.
-            if (pMemb.type().positionalParams() != match->type().positionalParams()) {
-                return false;
-            }
-            for (YmParamIndex j = 0; j < match->type().positionalParams(); j++) {
-                // Check positional param types.
-                if (!compare(
-                    pMemb.type(),
-                    pMemb.type().info->param(j)->typeConst,
-                    match->type(),
-                    match->type().param(j)->type())) {
-                    return false;
-                }
-            }
+        // Check return types.
+        if (!compare(
+            *pMembType,
+            pMembType->info->returnTypeConst().value(),
+            *matchType,
+            ym::deref(matchType->returnType()))) {
+            return false;
         }
-        else {
 #if _DUMP_CONFORMS_LOG
-            ym::println("YmType::conforms: Match not found!", pMemb.info->memberName());
+        ym::println("YmType::conforms: Positional Param Count: {} vs. {}", match->params(), pMemb.params());
+        ym::println("YmType::conforms: Positional Params:");
 #endif
+        // Check positional param counts.
+        if (pMembType->positionalParams() != matchType->positionalParams()) {
             return false;
         }
+        for (YmParamIndex j = 0; j < matchType->positionalParams(); j++) {
+            // Check positional param types.
+            if (!compare(
+                *pMembType,
+                pMembType->info->param(j)->typeConst,
+                *matchType,
+                matchType->param(j)->type())) {
+                return false;
+            }
+        }
+        return true;
+        });
+    if (!result) {
+        return false;
     }
 #if _DUMP_CONFORMS_LOG
     ym::println("YmType::conforms: Conforms!");
@@ -480,8 +504,11 @@ void YmType::_initConstsArrayToDummyIntConsts() {
     _consts.resize(info->consts.size(), _ym::Const::byType<YmInt>(0));
 }
 
-void YmType::_initFullname() {
+_ym::Spec YmType::_genFullname() const {
     const auto [owner, memberExt] = _ym::split_s<YmChar>(localName(), "::", true);
+    if (const auto ownerType = _id.owner()) {
+        return _ym::Spec::typeFast(std::format("{}{}", ownerType->fullname(), (std::string)memberExt));
+    }
     std::string argPack{};
     if (!typeArgs.empty()) {
         argPack += "[";
@@ -495,12 +522,49 @@ void YmType::_initFullname() {
         }
         argPack += "]";
     }
-    _fullname = _ym::Spec::typeFast(std::format("{}:{}{}{}", path(), (std::string)owner, argPack, (std::string)memberExt));
+    return _ym::Spec::typeFast(std::format("{}:{}{}{}", path(), (std::string)owner, argPack, (std::string)memberExt));
 }
 
-void YmType::_initFullname(YmType& owner) {
-    const auto [_, memberExt] = _ym::split_s<YmChar>(localName(), "::", true);
-    _fullname = _ym::Spec::typeFast(std::format("{}{}", owner.fullname(), (std::string)memberExt));
+std::optional<std::string> YmType::_genCallSuff() const {
+    if (!info->hasCallSig()) {
+        return std::nullopt;
+    }
+    std::string result{};
+    result += "(";
+    for (YmParams i = 0; i < positionalParams(); i++) {
+        if (i >= 1) {
+            result += ", ";
+        }
+        result += param(i)->type().fullname().string();
+    }
+    result += ") -> ";
+    result += returnType()->fullname().string();
+    return ym::retopt(result);
+}
+
+const std::optional<std::string>& YmType::_lazyCallSuff() const {
+    std::call_once(_callsuffFlag, [this]() {
+        // Generated once and cached, so the consts it's generated from must be final by now.
+        ymAssert(_callSigResolved());
+        _callsuff = _genCallSuff();
+        });
+    return _callsuff;
+}
+
+bool YmType::_callSigResolved() const noexcept {
+    if (!info->hasCallSig()) {
+        return true;
+    }
+    const auto isRef = [this](size_t index) { return _ym::constTypeOf(_consts[index]) == _ym::ConstType::Ref; };
+    if (!isRef(ym::deref(info->returnTypeConst()))) {
+        return false;
+    }
+    for (YmParams i = 0; i < params(); i++) {
+        if (!isRef(info->param(i)->typeConst)) {
+            return false;
+        }
+    }
+    return true;
 }
 
 const decltype(YmType::typeArgs)& YmType::_getTypeArgs() const noexcept {
@@ -515,8 +579,8 @@ YmType& YmType::TypeParam::arg() const noexcept {
     return *self->_getTypeArgs()[size_t(index())];
 }
 
-YmType& YmType::Member::type() const noexcept {
-    return *self->constAsRef(info->typeConst);
+YmType* YmType::Member::type() const {
+    return self->memberType(index());
 }
 
 YmType& YmType::Param::type() const noexcept {
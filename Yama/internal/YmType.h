@@ -8,15 +8,24 @@
 #endif
 
 
+#include <atomic>
+#include <concepts>
 #include <format>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "../yama/yama.h"
 #include "../yama++/Safe.h"
 #include "ConstTableInfo.h"
 #include "ParcelInfo.h"
 #include "Spec.h"
+#include "TypeId.h"
 #include "YmParcel.h"
 
 
@@ -37,6 +46,18 @@ namespace _ym {
     inline ConstType constTypeOf(const Const& x) noexcept {
         return ConstType(x.index());
     }
+
+    // Interface of the loader via which member types are materialized upon first access.
+    class MemberMaterializer {
+    public:
+        MemberMaterializer() = default;
+        virtual ~MemberMaterializer() noexcept = default;
+
+
+        // Materializes member type at index of owner, returning it, or nullptr upon failure.
+        // Errors are raised upon failure.
+        virtual YmType* materializeMember(YmType& owner, YmMemberIndex index) = 0;
+    };
 }
 
 
@@ -45,6 +66,7 @@ namespace _ym {
 struct YmType final : public std::enable_shared_from_this<YmType> {
 public:
     using Name = _ym::Spec;
+    using Id = _ym::TypeId;
 
     struct TypeParam final {
         using Info = _ym::TypeInfo::TypeParam;
@@ -69,7 +91,8 @@ public:
 
         inline YmMemberIndex index() const noexcept { return info->index; }
         inline const std::string& name() const noexcept { return info->name; }
-        YmType& type() const noexcept;
+        // Returns nullptr if materialization fails (see memberType.)
+        YmType* type() const;
     };
     struct Param final {
         using Info = _ym::TypeInfo::Param;
@@ -97,28 +120,30 @@ public:
     inline YmType(
         ym::Safe<YmParcel> parcel,
         ym::Safe<const _ym::TypeInfo> info,
-        std::vector<ym::Safe<YmType>> typeArgs = {}) :
+        std::vector<ym::Safe<YmType>> typeArgs = {},
+        _ym::MemberMaterializer* materializer = nullptr) :
         parcel(parcel),
         info(info),
         typeArgs(std::move(typeArgs)),
-        // TODO: This 'dummy' Spec is gross.
-        _fullname(_ym::Spec::pathFast("dummy")) {
+        _id(*parcel, *info, this->typeArgs),
+        _memberTypes(
+            info->members() > 0
+            ? std::make_unique<std::atomic<YmType*>[]>(info->members())
+            : nullptr),
+        _materializer(materializer) {
         ymAssert(!isMember() || this->typeArgs.empty());
         _initConstsArrayToDummyIntConsts();
-        _initFullname();
     }
     inline YmType(
         ym::Safe<YmParcel> parcel,
         ym::Safe<const _ym::TypeInfo> info,
-        YmType& owner) :
+        const YmType& owner) :
         parcel(parcel),
         info(info),
         typeArgs(std::move(typeArgs)),
-        // TODO: This 'dummy' Spec is gross.
-        _fullname(_ym::Spec::pathFast("dummy")) {
+        _id(*parcel, *info, owner) {
         ymAssert(!isMember() || this->typeArgs.empty());
         _initConstsArrayToDummyIntConsts();
-        _initFullname(owner);
     }
 
 
@@ -127,7 +152,8 @@ public:
 
     YmKind kind() const noexcept;
     const _ym::Spec& path() const noexcept;
-    const _ym::Spec& fullname() const noexcept;
+    // Generated lazily upon first request. Thread-safe.
+    const _ym::Spec& fullname() const;
     const std::string& localName() const noexcept;
 
     bool isRegular() const noexcept;
@@ -184,6 +210,8 @@ public:
     bool isTypeMethod() const noexcept;
     bool isObjMethod() const noexcept;
 
+    // Generated lazily upon first request. Thread-safe.
+    // Call only once constant table is fully populated.
     std::optional<std::string> callsuff() const;
     std::optional<_ym::Spec> callsig() const;
 
@@ -204,11 +232,25 @@ public:
 
     YmTypeParams typeParams() const noexcept;
     std::optional<TypeParam> typeParam(YmTypeParamIndex index) const noexcept;
-    std::optional<TypeParam> typeParam(const std::string& name) const noexcept;
+    std::optional<TypeParam> typeParam(std::string_view name) const noexcept;
 
     YmMembers members() const noexcept;
     std::optional<Member> member(YmMemberIndex index) const noexcept;
-    std::optional<Member> member(const std::string& name) const noexcept;
+    std::optional<Member> member(std::string_view name) const noexcept;
+
+    // Member types are materialized lazily, upon first access via memberType.
+    // Owner consts of the form '$Self::[MEMBER]' are left unresolved unless needed
+    // by the owner (ie. for its refs), w/ members instead being reached via this.
+
+    // Returns member type at index, materializing it if needed. Thread-safe.
+    // Returns nullptr if materialization fails.
+    YmType* memberType(YmMemberIndex index) const;
+    // Returns member type at index, or nullptr if not yet materialized. Thread-safe.
+    YmType* tryMemberType(YmMemberIndex index) const noexcept;
+    // Makes member available via memberType. Call only once member is committed.
+    void publishMember(YmMemberIndex index, YmType& member) const noexcept;
+    // Records dep as a type which our (possibly unmaterialized) members depend upon.
+    void addMemberDep(YmType& dep);
 
     YmType* returnType() const noexcept;
     YmParams params() const noexcept;
@@ -225,8 +267,51 @@ public:
     bool depends(ym::Safe<YmType> other) const noexcept;
 
     bool conforms(ym::Safe<YmType> protocol) const noexcept;
+    // Invokes visitor as visitor(pMemb, match) for each member pMemb of protocol, in order, w/ match
+    // being our member which pMemb is matched against by conforms (or std::nullopt if none), stopping
+    // (and returning false) upon visitor returning false.
+    // This is how conforms matches members, so code needing to access the same member types as it
+    // (ie. to materialize them beforehand) needn't duplicate its matching rules.
+    template<typename Visitor>
+        requires std::is_invocable_r_v<bool, Visitor, const Member&, const std::optional<Member>&>
+    inline bool forEachConformanceMatch(const YmType& protocol, Visitor&& visitor) const {
+        for (YmMemberIndex i = 0; i < protocol.members(); i++) {
+            const auto pMemb = ym::deref(protocol.member(i));
+            if (!visitor(pMemb, member(pMemb.name()))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Invokes visitor for each type we depend upon (ie. for reachability analysis.)
+    // This covers ref consts, type args, owner, and members (and their deps.)
+    template<std::invocable<const YmType&> Visitor>
+    inline void visitDeps(Visitor&& visitor) const {
+        for (const auto& c : _consts) {
+            if (const auto ref = c.tryAs<ym::Safe<YmType>>()) {
+                visitor(std::as_const(**ref));
+            }
+        }
+        for (const auto& arg : typeArgs) {
+            visitor(std::as_const(*arg));
+        }
+        if (const auto ownerType = _id.owner()) {
+            visitor(*ownerType);
+        }
+        for (YmMemberIndex i = 0; i < members(); i++) {
+            if (const auto memberType = tryMemberType(i)) {
+                visitor(std::as_const(*memberType));
+            }
+        }
+        for (const auto& dep : _memberDeps) {
+            visitor(std::as_const(*dep));
+        }
+    }
 
-    inline const Name& getName() const noexcept { return fullname(); }
+    // Generates fullname if not yet generated, and so may throw (ie. upon alloc failure.)
+    inline const Name& getName() const { return fullname(); }
+    inline const Id& getId() const noexcept { return _id; }
 
     std::span<const _ym::Const> consts() const noexcept;
     template<_ym::ConstType I>
@@ -256,7 +341,14 @@ public:
 
 
 private:
-    _ym::Spec _fullname;
+    _ym::TypeId _id; // Identity/hashing uses this, not _fullname.
+
+    // Most types (in particular members) never have their fullname/callsuff queried, so these
+    // strings are generated lazily to avoid the cost of generating/storing them.
+
+    mutable std::once_flag _fullnameFlag, _callsuffFlag;
+    mutable std::optional<_ym::Spec> _fullname;
+    mutable std::optional<std::string> _callsuff;
 
     // TODO: Later revise to make our _consts inline w/ the memory block of YmType itself via HAStruct.
 
@@ -268,10 +360,19 @@ private:
 
     std::vector<YmType*> _refs;
 
+    // Slots are nullptr until their member is materialized and published.
+
+    std::unique_ptr<std::atomic<YmType*>[]> _memberTypes;
+    _ym::MemberMaterializer* _materializer = nullptr; // Outlives us.
+    std::vector<ym::Safe<YmType>> _memberDeps; // So these are retained alongside us.
+
 
     void _initConstsArrayToDummyIntConsts();
-    void _initFullname();
-    void _initFullname(YmType& owner);
+    _ym::Spec _genFullname() const;
+    std::optional<std::string> _genCallSuff() const;
+    const std::optional<std::string>& _lazyCallSuff() const;
+    // Returns if the return/param type consts _genCallSuff reads are all resolved refs.
+    bool _callSigResolved() const noexcept;
 
     // Discerns type args vector to use, forwarding to owner for member types.
     const decltype(typeArgs)& _getTypeArgs() const noexcept;
@@ -9,4 +9,6 @@
 #include "../internal/YmParcel.h"
 #include "../internal/YmType.h"
 #include "../internal/YmObj.h"
+#include "../internal/YmExecutor.h"
+#include "../internal/YmSuspension.h"
 
@@ -35,6 +35,10 @@ thread_local _ym::ErrCallbackInfo _ym::Global::_errCallbackInfo = ErrCallbackInf
 const std::regex _ym::Global::_legalPathPattern = std::regex("[^/:]+(/[^/:]+)*");
 const std::regex _ym::Global::_legalFullnamePattern = std::regex("[^/:]+(/[^/:]+)*:[^/:]+(::[^/:]+)?");
 
+_ym::ErrCallbackInfo _ym::Global::errCallback() noexcept {
+    return _errCallbackInfo;
+}
+
 void _ym::Global::setErrCallback(YmErrCallbackFn fn, void* user) noexcept {
     _errCallbackInfo = ErrCallbackInfo{
         .fn = fn,
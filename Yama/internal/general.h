@@ -49,6 +49,7 @@ namespace _ym {
         Global() = delete;
 
 
+        static ErrCallbackInfo errCallback() noexcept;
         static void setErrCallback(YmErrCallbackFn fn, void* user) noexcept;
         static bool pathIsLegal(std::string_view path);
         static bool fullnameIsLegal(std::string_view fullname);
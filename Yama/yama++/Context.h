@@ -98,13 +98,14 @@ namespace ym {
             ymCtx_NaturalizeType(get(), Safe<YmType>(x));
         }
 
-        inline Object newNone() noexcept { return Object(Safe(ymCtx_NewNone(get())), false); }
-        inline Object newInt(YmInt v) noexcept { return Object(Safe(ymCtx_NewInt(get(), v)), false); }
-        inline Object newUInt(YmUInt v) noexcept { return Object(Safe(ymCtx_NewUInt(get(), v)), false); }
-        inline Object newFloat(YmFloat v) noexcept { return Object(Safe(ymCtx_NewFloat(get(), v)), false); }
-        inline Object newBool(YmBool v) noexcept { return Object(Safe(ymCtx_NewBool(get(), v)), false); }
-        inline Object newRune(YmRune v) noexcept { return Object(Safe(ymCtx_NewRune(get(), v)), false); }
-        inline Object newType(const Type& v) noexcept { return Object(Safe(ymCtx_NewType(get(), v.get())), false); }
+        // These return std::nullopt if allocation fails (eg. memory limit exceeded.)
+        inline std::optional<Object> newNone() noexcept { return Object::maybe(ymCtx_NewNone(get()), false); }
+        inline std::optional<Object> newInt(YmInt v) noexcept { return Object::maybe(ymCtx_NewInt(get(), v), false); }
+        inline std::optional<Object> newUInt(YmUInt v) noexcept { return Object::maybe(ymCtx_NewUInt(get(), v), false); }
+        inline std::optional<Object> newFloat(YmFloat v) noexcept { return Object::maybe(ymCtx_NewFloat(get(), v), false); }
+        inline std::optional<Object> newBool(YmBool v) noexcept { return Object::maybe(ymCtx_NewBool(get(), v), false); }
+        inline std::optional<Object> newRune(YmRune v) noexcept { return Object::maybe(ymCtx_NewRune(get(), v), false); }
+        inline std::optional<Object> newType(const Type& v) noexcept { return Object::maybe(ymCtx_NewType(get(), v.get()), false); }
 
         inline CallStack callStack() const noexcept { return CallStack(*this); }
         
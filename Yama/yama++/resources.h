@@ -50,6 +50,19 @@ namespace ym {
         static constexpr auto release = ymObj_Release;
         static constexpr auto refCount = ymObj_RefCount;
     };
+    template<>
+    struct ResTraits<YmExecutor> final {
+        static constexpr auto create = ymExecutor_Create;
+        static constexpr auto secure = ymExecutor_Secure;
+        static constexpr auto release = ymExecutor_Release;
+        static constexpr auto refCount = ymExecutor_RefCount;
+    };
+    template<>
+    struct ResTraits<YmSuspension> final {
+        static constexpr auto secure = ymSuspension_Secure;
+        static constexpr auto release = ymSuspension_Release;
+        static constexpr auto refCount = ymSuspension_RefCount;
+    };
 
 
     template<typename T>
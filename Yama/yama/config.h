@@ -11,6 +11,18 @@
 #define YM_DEBUG 1
 #endif
 
+/* Define YM_LOAD_STATS to gather loading statistics (see ymDm_GetLoadStats.) */
+/* If not defined, the code gathering them is compiled out. */
+#if defined(DEBUG) && !defined(YM_LOAD_STATS)
+#define YM_LOAD_STATS 1
+#endif
+
+/* YM_CTX_STATS is defined to gather context runtime statistics (see ymCtx_GetStats), unless */
+/* YM_NO_CTX_STATS is defined, in which case the code gathering them is compiled out. */
+#if !defined(YM_NO_CTX_STATS) && !defined(YM_CTX_STATS)
+#define YM_CTX_STATS 1
+#endif
+
 
 #endif
 
@@ -7,7 +7,7 @@
 
 
 const YmChar* ymFmtYmErrCode(YmErrCode code) {
-    static_assert(YmErrCode_Num == 37);
+    static_assert(YmErrCode_Num == 40);
     switch (code) {
     case YmErrCode_IllegalSpecifier:            return "IllegalSpecifier";
     case YmErrCode_IllegalConstraint:           return "IllegalConstraint";
@@ -45,6 +45,9 @@ const YmChar* ymFmtYmErrCode(YmErrCode code) {
     case YmErrCode_CallStackOverflow:           return "CallStackOverflow";
     case YmErrCode_NoDefaultValue:              return "NoDefaultValue";
     case YmErrCode_IllegalConversion:           return "IllegalConversion";
+    case YmErrCode_ImageError:                  return "ImageError";
+    case YmErrCode_Interrupted:                 return "Interrupted";
+    case YmErrCode_MemLimitExceeded:            return "MemLimitExceeded";
     case YmErrCode_InternalError:               return "InternalError";
     default:                                    return "???";
     }
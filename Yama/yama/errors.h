@@ -60,6 +60,9 @@ extern "C" {
         YmErrCode_CallStackOverflow,        /* Call stack overflow. */
         YmErrCode_NoDefaultValue,           /* No default value. */
         YmErrCode_IllegalConversion,        /* Illegal conversion. */
+        YmErrCode_ImageError,               /* Image error. */
+        YmErrCode_Interrupted,              /* Call interrupted. */
+        YmErrCode_MemLimitExceeded,         /* Memory limit exceeded (incl. allocator failure.) */
         YmErrCode_InternalError,            /* Internal Error */
 
         YmErrCode_Num,                      /* Enum size. Not a valid error code. */
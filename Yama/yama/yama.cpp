@@ -3,6 +3,7 @@
 #include "yama.h"
 
 #include <array>
+#include <cstring>
 
 #include "../internal/general.h"
 #include "../internal/frontend-resources.h"
@@ -119,12 +120,77 @@ void ymInertCallBhvrFn(YmCtx*, YmType*, void*) {
     // Do nothing.
 }
 
+const YmChar* ymLoadStat_Fmt(YmLoadStat x) {
+    static_assert(YmLoadStat_Num == 13);
+    static constexpr std::array<const YmChar*, YmLoadStat_Num> names{
+        "SpecifiersParsed",
+        "TypesGenerated",
+        "EarlyResolutions",
+        "LateResolutions",
+        "ConstraintChecks",
+        "PTablesBuilt",
+        "AccessLockWaitTime",
+        "UpdateLockWaitTime",
+        "InterpretTime",
+        "LateResolveTime",
+        "ConstraintCheckTime",
+        "CallSigCheckTime",
+        "CommitTime",
+    };
+    return
+        x < YmLoadStat_Num
+        ? names[size_t(x)]
+        : "???";
+}
+
+const YmChar* ymMemStat_Fmt(YmMemStat x) {
+    static_assert(YmMemStat_Num == 4);
+    static constexpr std::array<const YmChar*, YmMemStat_Num> names{
+        "Bytes",
+        "PeakBytes",
+        "Objects",
+        "Allocations",
+    };
+    return
+        x < YmMemStat_Num
+        ? names[size_t(x)]
+        : "???";
+}
+
+const YmChar* ymCtxStat_Fmt(YmCtxStat x) {
+    static_assert(YmCtxStat_Num == 12);
+    static constexpr std::array<const YmChar*, YmCtxStat_Num> names{
+        "Calls",
+        "ProtocolCalls",
+        "AccessorCalls",
+        "FailedCalls",
+        "ObjectsCreated",
+        "ObjectsReleased",
+        "Conversions",
+        "Boxings",
+        "Unboxings",
+        "PTablesBuilt",
+        "PeakObjectStackHeight",
+        "PeakCallStackHeight",
+    };
+    return
+        x < YmCtxStat_Num
+        ? names[size_t(x)]
+        : "???";
+}
+
 YmDm* ymDm_Create(void) {
     auto result = new YmDm();
     result->refs.addRef();
     return result;
 }
 
+YmDm* ymDm_CreateWithAllocator(const YmAllocator* allocator) {
+    auto result = new YmDm(allocator ? std::make_optional(*allocator) : std::nullopt);
+    result->refs.addRef();
+    return result;
+}
+
 YmRefCount ymDm_Secure(YmDm* dm) {
     return dm ? Safe(dm)->refs.addRef() : 0;
 }
@@ -157,12 +223,55 @@ size_t ymDm_ForEachParcel(YmDm* dm, YmForEachParcelCallbackFn callback, void* us
     return Safe(dm)->forEachParcel(callback, user);
 }
 
+YmBool ymDm_PreloadAsync(YmDm* dm, const YmFullname* fullnames, size_t n) {
+    ymAssert(fullnames != nullptr || n == 0);
+    return (YmBool)Safe(dm)->preloadAsync(std::span(fullnames, n));
+}
+
+YmBool ymDm_PreloadDone(YmDm* dm) {
+    return (YmBool)Safe(dm)->preloadDone();
+}
+
+YmBool ymDm_WaitPreload(YmDm* dm) {
+    return (YmBool)Safe(dm)->waitPreload();
+}
+
+size_t ymDm_CollectTypes(YmDm* dm) {
+    return Safe(dm)->collectTypes();
+}
+
+void ymDm_GetLoadStats(YmDm* dm, YmUInt64* stats) {
+    Safe(dm)->loader->stats().get(Safe(stats));
+}
+
+void ymDm_ResetLoadStats(YmDm* dm) {
+    Safe(dm)->loader->stats().reset();
+}
+
+YmBool ymDm_SaveImage(YmDm* dm, const YmChar* path) {
+    return (YmBool)Safe(dm)->saveImage(std::string(Safe(path)));
+}
+
+YmBool ymDm_LoadImage(YmDm* dm, const YmChar* path, YmRelinkCallBhvrCallbackFn relink, void* user) {
+    return (YmBool)Safe(dm)->loadImage(std::string(Safe(path)), relink, user);
+}
+
 YmCtx* ymCtx_Create(YmDm* dm) {
     auto result = new YmCtx(Safe(dm));
     result->refs.addRef();
     return result;
 }
 
+YmCtx* ymCtx_CreateWithAllocator(YmDm* dm, const YmAllocator* allocator) {
+    auto result = new YmCtx(Safe(dm), allocator ? std::make_optional(*allocator) : Safe(dm)->allocator);
+    result->refs.addRef();
+    return result;
+}
+
+YmCtx* ymDm_AcquireCtx(YmDm* dm) {
+    return Safe(dm)->acquireCtx();
+}
+
 YmRefCount ymCtx_Secure(YmCtx* ctx) {
     return ctx ? Safe(ctx)->refs.addRef() : 0;
 }
@@ -178,6 +287,17 @@ YmRefCount ymCtx_Release(YmCtx* ctx) {
     return old;
 }
 
+YmRefCount ymCtx_ReturnToPool(YmCtx* ctx) {
+    if (!ctx) {
+        return 0;
+    }
+    auto old = Safe(ctx)->refs.drop();
+    if (old == 1) {
+        Safe(ctx)->domain->returnCtx(Safe(ctx));
+    }
+    return old;
+}
+
 YmRefCount ymCtx_RefCount(YmCtx* ctx) {
     return ctx ? Safe(ctx)->refs.count() : 0;
 }
@@ -225,6 +345,26 @@ YmType* ymCtx_LdType(YmCtx* ctx) {
     return &Safe(ctx)->loader->ldType();
 }
 
+void ymCtx_GetLoadStats(YmCtx* ctx, YmUInt64* stats) {
+    Safe(ctx)->loader->stats().get(Safe(stats));
+}
+
+void ymCtx_ResetLoadStats(YmCtx* ctx) {
+    Safe(ctx)->loader->stats().reset();
+}
+
+void ymCtx_GetStats(YmCtx* ctx, YmUInt64* stats) {
+    Safe(ctx)->stats.get(Safe(stats));
+}
+
+void ymCtx_GetConversionStats(YmCtx* ctx, YmUInt64* stats) {
+    Safe(ctx)->stats.getConversions(Safe(stats));
+}
+
+void ymCtx_ResetStats(YmCtx* ctx) {
+    Safe(ctx)->stats.reset();
+}
+
 void ymCtx_NaturalizeParcel(YmCtx* ctx, YmParcel* parcel) {
     assertSafe(ctx);
     assertSafe(parcel);
@@ -370,6 +510,66 @@ YmBool ymCtx_Call(YmCtx* ctx, YmType* fn, YmUInt16 argsN, const YmChar* argNames
     return Safe(ctx)->call(fn, argsN, std::string_view(Safe(argNames)), returnTo);
 }
 
+void ymCtx_RequestInterrupt(YmCtx* ctx) {
+    Safe(ctx)->requestInterrupt();
+}
+
+void ymCtx_SetCallTimeLimit(YmCtx* ctx, YmUInt64 ms) {
+    Safe(ctx)->setCallTimeLimit(std::chrono::milliseconds(ms));
+}
+
+void ymCtx_MemUsage(YmCtx* ctx, YmType* type, YmUInt64* stats) {
+    Safe(ctx)->memUsage(type, Safe(stats));
+}
+
+void ymCtx_SetMemLimit(YmCtx* ctx, YmUInt64 bytes) {
+    Safe(ctx)->setMemLimit(bytes);
+}
+
+YmBool ymCtx_Interrupted(YmCtx* ctx) {
+    return Safe(ctx)->interrupted();
+}
+
+const YmChar* ymCtx_HeapSnapshot(YmCtx* ctx, YmBool graph) {
+    auto temp = Safe(ctx)->heapSnapshot(graph);
+    return mkCStr(temp.c_str());
+}
+
+YmSuspension* ymCtx_Suspend(YmCtx* ctx) {
+    return Safe(ctx)->suspend();
+}
+
+YmBool ymCtx_Resume(YmCtx* ctx, YmSuspension* suspension, YmLocal returnTo) {
+    return Safe(ctx)->resume(deref(suspension), returnTo);
+}
+
+YmBool ymCtx_Resumed(YmCtx* ctx) {
+    return Safe(ctx)->resumed();
+}
+
+YmBool ymCtx_Suspended(YmCtx* ctx) {
+    return Safe(ctx)->suspended();
+}
+
+YmRefCount ymSuspension_Secure(YmSuspension* suspension) {
+    return suspension ? Safe(suspension)->refs.addRef() : 0;
+}
+
+YmRefCount ymSuspension_Release(YmSuspension* suspension) {
+    if (!suspension) {
+        return 0;
+    }
+    auto old = Safe(suspension)->refs.drop();
+    if (old == 1) {
+        delete Safe(suspension).get();
+    }
+    return old;
+}
+
+YmRefCount ymSuspension_RefCount(YmSuspension* suspension) {
+    return suspension ? Safe(suspension)->refs.count() : 0;
+}
+
 void ymCtx_Ret(YmCtx* ctx, YmObj* what, YmRefPolicy whatPolicy) {
     Safe(ctx)->ret(what, whatPolicy);
 }
@@ -394,6 +594,60 @@ YmBool ymCtx_Convert(YmCtx* ctx, YmType* type, YmLocal returnTo) {
     return Safe(ctx)->convert(deref(type), returnTo);
 }
 
+YmBool ymCtx_Marshal(YmCtx* dst, YmCtx* src, YmLocal local) {
+    return Safe(dst)->marshal(deref(src), local);
+}
+
+YmExecutor* ymExecutor_Create(YmDm* dm, size_t workers) {
+    auto result = new YmExecutor(Safe(dm), workers);
+    result->refs.addRef();
+    return result;
+}
+
+YmRefCount ymExecutor_Secure(YmExecutor* executor) {
+    return executor ? Safe(executor)->refs.addRef() : 0;
+}
+
+YmRefCount ymExecutor_Release(YmExecutor* executor) {
+    if (!executor) {
+        return 0;
+    }
+    auto old = Safe(executor)->refs.drop();
+    if (old == 1) {
+        delete Safe(executor).get();
+    }
+    return old;
+}
+
+YmRefCount ymExecutor_RefCount(YmExecutor* executor) {
+    return executor ? Safe(executor)->refs.count() : 0;
+}
+
+size_t ymExecutor_Workers(YmExecutor* executor) {
+    return Safe(executor)->workers();
+}
+
+YmBool ymExecutor_Submit(
+    YmExecutor* executor,
+    YmFullname fn,
+    const YmPrimitive* args,
+    YmUInt16 argsN,
+    const YmChar* argNames,
+    YmExecutorCallbackFn callback,
+    void* user) {
+    ymAssert(args != nullptr || argsN == 0);
+    return (YmBool)Safe(executor)->submit(
+        std::string(Safe(fn)),
+        std::span(args, argsN),
+        std::string(Safe(argNames)),
+        callback,
+        user);
+}
+
+void ymExecutor_Wait(YmExecutor* executor) {
+    Safe(executor)->wait();
+}
+
 YmParcelDef* ymParcelDef_Create(void) {
     auto result = new YmParcelDef();
     result->refs.addRef();
@@ -615,6 +869,32 @@ YmRef ymParcelDef_AddRef(
         .value_or(YM_NO_REF);
 }
 
+size_t ymParcelDef_AddBulk(YmParcelDef* parceldef, const YmTypeDesc* descs, size_t n) {
+    ymAssert(descs != nullptr || n == 0);
+    return Safe(parceldef)->addBulk(std::span(descs, n));
+}
+
+size_t ymParcelDef_Serialize(YmParcelDef* parceldef, void* buffer, size_t bufferSize) {
+    const auto result = Safe(parceldef)->serialize();
+    if (!result) {
+        return 0;
+    }
+    if (result->size() <= bufferSize) {
+        ymAssert(buffer != nullptr);
+        std::memcpy(buffer, result->data(), result->size());
+    }
+    return result->size();
+}
+
+YmParcelDef* ymParcelDef_Deserialize(const void* data, size_t size, YmRelinkCallBhvrCallbackFn relink, void* user) {
+    ymAssert(data != nullptr);
+    auto result = YmParcelDef::deserialize(std::string_view((const YmChar*)data, size), relink, user);
+    if (result) {
+        result->refs.addRef();
+    }
+    return result.release();
+}
+
 YmPath ymParcel_Path(YmParcel* parcel) {
     return Safe(parcel)->path.string().c_str();
 }
@@ -643,7 +923,7 @@ YmType* ymType_MemberByIndex(YmType* type, YmMemberIndex member) {
     auto memb = Safe(type)->member(member);
     return
         memb
-        ? &memb->type()
+        ? memb->type()
         : nullptr;
 }
 
@@ -651,7 +931,7 @@ YmType* ymType_MemberByName(YmType* type, const YmChar* name) {
     auto memb = Safe(type)->member(std::string(Safe(name)));
     return
         memb
-        ? &memb->type()
+        ? memb->type()
         : nullptr;
 }
 
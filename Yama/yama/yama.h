@@ -314,6 +314,13 @@ extern "C" {
     /* Objects are RC resources encapsulating a Yama object. */
     struct YmObj;
 
+    /* Executors are ARC resources encapsulating a pool of worker threads, each w/ a context of its own, which perform calls submitted to the executor. */
+    /* Executors are thread-safe. */
+    struct YmExecutor;
+
+    /* Suspensions are RC resources encapsulating a suspended call (see ymCtx_Suspend.) */
+    struct YmSuspension;
+
 
     typedef enum : YmUInt8 {
         YmKind_Struct = 0,
@@ -569,11 +576,107 @@ extern "C" {
     void ymInertCallBhvrFn(struct YmCtx*, struct YmType*, void*);
 
 
+    /* YmLoadStat specifies a loading statistic gathered by a domain/context. */
+    /* Times are wall times in nanoseconds. */
+    typedef enum : YmUInt8 {
+        YmLoadStat_SpecifiersParsed = 0,    /* Specifiers (ie. paths, fullnames, and ref. symbols) parsed. */
+        YmLoadStat_TypesGenerated,          /* Types whose type data was generated. */
+        YmLoadStat_EarlyResolutions,        /* Constants resolved via early resolution. */
+        YmLoadStat_LateResolutions,         /* Ref. constants resolved via late resolution. */
+        YmLoadStat_ConstraintChecks,        /* Type arguments checked for conformance to their constraints. */
+        YmLoadStat_PTablesBuilt,            /* Protocol tables built (ie. upon boxing objects.) */
+        YmLoadStat_AccessLockWaitTime,      /* Time spent waiting to access a domain's loaded types/parcels. */
+        YmLoadStat_UpdateLockWaitTime,      /* Time spent waiting to import/load via a domain. */
+        YmLoadStat_InterpretTime,           /* Time spent interpreting specifiers imported/loaded (incl. early resolution.) */
+        YmLoadStat_LateResolveTime,         /* Time spent performing late resolution. */
+        YmLoadStat_ConstraintCheckTime,     /* Time spent checking constraints. */
+        YmLoadStat_CallSigCheckTime,        /* Time spent checking ref. constant call signature conformance. */
+        YmLoadStat_CommitTime,              /* Time spent committing imported/loaded parcels/types. */
+
+        YmLoadStat_Num, /* Enum size. Not a valid load stat. */
+    } YmLoadStat;
+
+    /* TODO: ymLoadStat_Fmt hasn't been unit tested.
+    */
+
+    /* Returns the string name of load stat x, or "???" if x is invalid. */
+    /* The memory of the returned string is static and is valid for the lifetime of the process. */
+    const YmChar* ymLoadStat_Fmt(YmLoadStat x);
+
+
+    /* YmMemStat specifies a memory usage statistic gathered by a context (see ymCtx_MemUsage.) */
+    /* Sizes are in bytes. */
+    typedef enum : YmUInt8 {
+        YmMemStat_Bytes = 0,    /* Object memory currently allocated. */
+        YmMemStat_PeakBytes,    /* Most object memory allocated at once. */
+        YmMemStat_Objects,      /* Objects currently allocated. */
+        YmMemStat_Allocations,  /* Objects allocated in total. */
+
+        YmMemStat_Num, /* Enum size. Not a valid memory stat. */
+    } YmMemStat;
+
+    /* TODO: ymMemStat_Fmt hasn't been unit tested.
+    */
+
+    /* Returns the string name of memory stat x, or "???" if x is invalid. */
+    /* The memory of the returned string is static and is valid for the lifetime of the process. */
+    const YmChar* ymMemStat_Fmt(YmMemStat x);
+
+
+    /* YmCtxStat specifies a runtime statistic gathered by a context (see ymCtx_GetStats.) */
+    typedef enum : YmUInt8 {
+        YmCtxStat_Calls = 0,                /* Calls made (incl. those which failed.) */
+        YmCtxStat_ProtocolCalls,            /* Calls of protocol methods (forwarded via ptable.) */
+        YmCtxStat_AccessorCalls,            /* Calls of (computed) var/property accessors. */
+        YmCtxStat_FailedCalls,              /* Calls which began, but failed to complete (excl. those suspended.) */
+        YmCtxStat_ObjectsCreated,           /* Objects created. */
+        YmCtxStat_ObjectsReleased,          /* Objects released (ie. destroyed.) */
+        YmCtxStat_Conversions,              /* Conversions performed (incl. boxing/unboxing.) */
+        YmCtxStat_Boxings,                  /* Objects boxed (incl. reboxing P -> P.) */
+        YmCtxStat_Unboxings,                /* Objects unboxed. */
+        YmCtxStat_PTablesBuilt,             /* Protocol tables built. */
+        YmCtxStat_PeakObjectStackHeight,    /* Most objects on the object stack at once. */
+        YmCtxStat_PeakCallStackHeight,      /* Most call frames on the call stack at once. */
+
+        YmCtxStat_Num, /* Enum size. Not a valid context stat. */
+    } YmCtxStat;
+
+    /* TODO: ymCtxStat_Fmt hasn't been unit tested.
+    */
+
+    /* Returns the string name of context stat x, or "???" if x is invalid. */
+    /* The memory of the returned string is static and is valid for the lifetime of the process. */
+    const YmChar* ymCtxStat_Fmt(YmCtxStat x);
+
+
+    /* An allocator, supplied by the end-user, which contexts use to allocate/deallocate the memory of */
+    /* their objects (eg. to use an arena, or a bump allocator which is reset per request.) */
+    /* user is a pointer used to expose the callback functions to external data. */
+    /* allocate is to return a block of at least bytes bytes, w/ alignment alignof(max_align_t). */
+    /* deallocate is only ever passed blocks returned by allocate, and never YM_NIL. */
+    /* Callback functions are called only by the thread using the context. */
+    /* allocate may fail by returning YM_NIL, w/ the object creation it was for failing w/ YmErrCode_MemLimitExceeded. */
+    /* allocate must not throw, or otherwise unwind through the context. */
+    typedef struct {
+        void* user;
+        void* (*allocate)(void* user, size_t bytes);
+        void (*deallocate)(void* user, void* block);
+    } YmAllocator;
+
+
     /* Domain API */
 
     /* Creates a new Yama domain, returning a pointer to it. */
     struct YmDm* ymDm_Create(void);
 
+    /* Creates a new Yama domain, w/ contexts created w/ it using allocator by default, returning a pointer to it. */
+    /* allocator is copied, w/ allocator->user needing to remain valid for the lifetime of the domain, and its contexts. */
+    /* allocator == YM_NIL specifies the default allocator. */
+    /* Undefined Behaviour: */
+    /*   - allocator (pointer) is invalid (but not YM_NIL.) */
+    /*   - allocator->allocate or allocator->deallocate are invalid. */
+    struct YmDm* ymDm_CreateWithAllocator(const YmAllocator* allocator);
+
     /* Increments the ref count of domain dm. */
     /* Returns old ref count value of dm, or 0. */
     /* Failure: */
@@ -694,6 +797,136 @@ extern "C" {
     /*   - callback is invalid. */
     size_t ymDm_ForEachParcel(struct YmDm* dm, YmForEachParcelCallbackFn callback, void* user);
 
+    /* NOTE: Preloading lets the end-user warm up the domain's type cache ahead of time, loading types on a
+    *        background thread such that later loads (by contexts) of those types are simple lookups.
+    * 
+    *        Preloads are performed via the same path as regular loads, and so all-or-nothing semantics
+    *        apply to each individual type preloaded, and preloading a type which is already loaded is a no-op.
+    * 
+    *        Errors raised during a preload are reported via the err callback of the thread which called
+    *        ymDm_PreloadAsync (at the time of the call), but from the background thread.
+    * 
+    *        Destroying dm will block until all of its preloads have completed.
+    */
+
+    /* Begins asynchronously loading the types specified by fullnames, returning if successful. */
+    /* Returning successfully does not mean the types loaded successfully, only that the preload began. */
+    /* n is the number of fullnames. */
+    /* Failure: */
+    /*   - Any fullname specified is illegal. */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    /*   - fullnames is invalid. */
+    /*   - Any fullname (pointer) is invalid. */
+    YmBool ymDm_PreloadAsync(struct YmDm* dm, const YmFullname* fullnames, size_t n);
+
+    /* Returns if all preloads of dm have completed, without blocking. */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    YmBool ymDm_PreloadDone(struct YmDm* dm);
+
+    /* Blocks until all preloads of dm have completed, returning if all preloaded types loaded successfully. */
+    /* Returns YM_TRUE if there were no preloads to wait on. */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    YmBool ymDm_WaitPreload(struct YmDm* dm);
+
+    /* NOTE: Domains reclaim generic type instantiations (and their members) which are no longer in use, w/
+    *        an instantiation being in use if a live context has loaded it, or if it's reachable (ie. via refs,
+    *        type args, or members) from a type which is in use. Non-generic types are always in use. Contexts
+    *        pooled via ymCtx_ReturnToPool drop the types they loaded, and so don't keep them in use.
+    * 
+    *        Collection occurs automatically, on a background thread, once the number of types loaded by the
+    *        domain grows sufficiently since the last collection, and can also be performed explicitly via
+    *        ymDm_CollectTypes.
+    * 
+    *        Collection blocks loads/imports only while taking a snapshot of the types loaded by the domain,
+    *        and while removing reclaimed types from the domain, w/ lookups of already loaded types being
+    *        blocked only for the latter.
+    * 
+    *        Types acquired via a context remain valid for as long as said context does. Reclaimed types are
+    *        reloaded if needed again, w/ the reloaded type being a new type.
+    */
+
+    /* Reclaims generic type instantiations of dm which are no longer in use, returning the number of types reclaimed. */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    size_t ymDm_CollectTypes(struct YmDm* dm);
+
+    /* NOTE: Domains and contexts gather loading statistics (see YmLoadStat), w/ those of a context covering
+    *        its imports/loads, and the work its domain performs on their behalf, and w/ those of a domain
+    *        covering all of its imports/loads (ie. incl. those performed on behalf of contexts.)
+    * 
+    *        Stats are only gathered if Yama is compiled w/ YM_LOAD_STATS defined (see config.h), w/ them
+    *        otherwise always being 0.
+    */
+
+    /* Writes the load stats of dm to stats, indexed by YmLoadStat. */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    /*   - stats is not a valid array of YmLoadStat_Num elements. */
+    void ymDm_GetLoadStats(struct YmDm* dm, YmUInt64* stats);
+
+    /* Resets the load stats of dm to 0. */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    void ymDm_ResetLoadStats(struct YmDm* dm);
+
+    /* NOTE: Domain images let the end-user skip much of the work of setting up a domain upon startup, by
+    *        saving the parcels bound to a domain, its redirects, and the types it has loaded, to a binary
+    *        file, which a later domain can then load, binding said parcels, adding said redirects, and
+    *        loading said types.
+    * 
+    *        Parcels are saved w/ their symbols already normalized, making them far cheaper to bind than
+    *        the parcel defs they were made from. Their specifiers and names are nevertheless checked
+    *        upon loading, so corrupted images fail to load, rather than yielding illegal parcels. The
+    *        yama parcel is never saved, as each domain binds its own.
+    * 
+    *        Non-builtin call behaviours (ie. those provided by the end-user) can't be saved, and so are
+    *        instead relinked, by the path and local name of their type, when the image is loaded.
+    */
+
+    /* A callback function used to relink non-builtin call behaviours upon loading a domain image, or */
+    /* deserializing a parcel def. */
+    /* user is a pointer used to expose callback function to external data. */
+    /* path is the path the parcel of the type was bound to, or YM_NIL if deserializing a parcel def. */
+    /* localName is the local name of the type whose call behaviour is to be relinked. */
+    /* fn is to be written the call behaviour callback function. */
+    /* fnUser is to be written the user pointer of the call behaviour callback function. */
+    /* Returns if successful. */
+    typedef YmBool(*YmRelinkCallBhvrCallbackFn)(
+        void* user,
+        YmPath path,
+        const YmChar* localName,
+        YmCallBhvrCallbackFn* fn,
+        void** fnUser);
+
+    /* Saves an image of dm to the file at path, returning if successful. */
+    /* Failure: */
+    /*   - The file could not be written. */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    /*   - path (pointer) is invalid. */
+    YmBool ymDm_SaveImage(struct YmDm* dm, const YmChar* path);
+
+    /* Loads the image in the file at path into dm, binding its parcels, adding its redirects, and loading its types, returning if successful. */
+    /* relink is used to relink non-builtin call behaviours, and may be YM_NIL if there are none to relink. */
+    /* Parcels are bound as ymDm_BindParcelDef binds them, and redirects are added as ymDm_AddRedirect adds them. */
+    /* Parcels/redirects are only bound/added if all of them could be read, relinked and bound, but stay bound/added even if types thereafter fail to load. */
+    /* Failure: */
+    /*   - The file could not be read. */
+    /*   - The file is not a domain image, or is of an incompatible version. */
+    /*   - The image is malformed (eg. truncated, or w/ an illegal specifier or name.) */
+    /*   - Any call behaviour could not be relinked. */
+    /*   - Any parcel of the image could not be bound. */
+    /*   - Any type of the image fails to load. */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    /*   - path (pointer) is invalid. */
+    /*   - relink is invalid. */
+    /*   - The image was not saved by ymDm_SaveImage, or was modified since (other than in ways detected as it being malformed.) */
+    YmBool ymDm_LoadImage(struct YmDm* dm, const YmChar* path, YmRelinkCallBhvrCallbackFn relink, void* user);
+
 
     /* Context API */
 
@@ -703,6 +936,27 @@ extern "C" {
     /*   - dm is invalid. */
     struct YmCtx* ymCtx_Create(struct YmDm* dm);
 
+    /* Creates a new Yama context, which allocates the memory of its objects w/ allocator, returning a pointer to it. */
+    /* allocator is copied, w/ allocator->user needing to remain valid for the lifetime of the context. */
+    /* allocator == YM_NIL specifies the default allocator of dm (see ymDm_CreateWithAllocator.) */
+    /* Contexts w/ an allocator other than the default of their domain are destroyed, rather than pooled, */
+    /* upon being returned to the pool (see ymCtx_ReturnToPool.) */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    /*   - allocator (pointer) is invalid (but not YM_NIL.) */
+    /*   - allocator->allocate or allocator->deallocate are invalid. */
+    struct YmCtx* ymCtx_CreateWithAllocator(struct YmDm* dm, const YmAllocator* allocator);
+
+    /* Acquires a context associated with dm from its pool of reusable contexts, returning a pointer to it. */
+    /* Creates a new context if the pool is empty. */
+    /* Acquiring a pooled context is much cheaper than creating a new one. */
+    /* Contexts acquired this way are otherwise the same as those created via ymCtx_Create (ie. they have no loaded types, vars or objects.) */
+    /* The returned context has a ref count of 1. */
+    /* Thread-safe. */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    struct YmCtx* ymDm_AcquireCtx(struct YmDm* dm);
+
     /* Increments the ref count of context ctx. */
     /* Returns old ref count value of ctx, or 0. */
     /* Failure: */
@@ -715,6 +969,16 @@ extern "C" {
     /*   - ctx == YM_NIL. (Quiet) (UNTESTED) */
     YmRefCount ymCtx_Release(struct YmCtx* ctx);
 
+    /* Decrements the ref count of context ctx, returning ctx to the pool of its domain (see ymDm_AcquireCtx) if it reaches 0, rather than destroying it. */
+    /* Contexts are reset upon return to the pool, releasing their objects, dropping the types they've loaded, and resetting their vars and stats, in time proportional to the number of objects and types. */
+    /* Contexts are destroyed rather than pooled if the pool is full, or if they use an allocator other than the default of their domain. */
+    /* Returns old ref count value of ctx, or 0. */
+    /* Failure: */
+    /*   - ctx == YM_NIL. (Quiet) */
+    /* Undefined Behaviour: */
+    /*   - ctx is not at user level (ie. is in the middle of a call.) */
+    YmRefCount ymCtx_ReturnToPool(struct YmCtx* ctx);
+
     /* Returns the ref count of context ctx, or 0. */
     /* Failure: */
     /*   - ctx == YM_NIL. (Quiet) (UNTESTED) */
@@ -776,6 +1040,44 @@ extern "C" {
     /*   - ctx is invalid. */
     struct YmType* ymCtx_LdType(struct YmCtx* ctx);
 
+    /* Writes the load stats of ctx to stats, indexed by YmLoadStat (see ymDm_GetLoadStats.) */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    /*   - stats is not a valid array of YmLoadStat_Num elements. */
+    void ymCtx_GetLoadStats(struct YmCtx* ctx, YmUInt64* stats);
+
+    /* Resets the load stats of ctx to 0. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    void ymCtx_ResetLoadStats(struct YmCtx* ctx);
+
+    /* NOTE: Contexts gather runtime statistics (see YmCtxStat), cheaply enough that they're always
+    *        gathered, to aid in capacity planning, w/ peak stats recording the most seen at once.
+    * 
+    *        Stats are gathered unless Yama is compiled w/ YM_NO_CTX_STATS defined (see config.h), w/
+    *        them otherwise always being 0.
+    */
+
+    /* Writes the runtime stats of ctx to stats, indexed by YmCtxStat. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    /*   - stats is not a valid array of YmCtxStat_Num elements. */
+    void ymCtx_GetStats(struct YmCtx* ctx, YmUInt64* stats);
+
+    /* Writes the number of conversions ctx has performed between each pair of primitive types to stats, */
+    /* a YmPrimitiveKind_Num x YmPrimitiveKind_Num matrix indexed [from * YmPrimitiveKind_Num + to]. */
+    /* Conversions involving non-primitive types (eg. boxing) are only counted by YmCtxStat_Conversions. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    /*   - stats is not a valid array of YmPrimitiveKind_Num * YmPrimitiveKind_Num elements. */
+    void ymCtx_GetConversionStats(struct YmCtx* ctx, YmUInt64* stats);
+
+    /* Resets the runtime stats (incl. conversion stats) of ctx to 0. */
+    /* Contexts returned to the pool of their domain have their runtime stats reset. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    void ymCtx_ResetStats(struct YmCtx* ctx);
+
     /* TODO: Better explain the specifics of why naturalization is needed.
     * 
     *        Explain that it's needed to legally use parcel/type ptrs across
@@ -846,36 +1148,50 @@ extern "C" {
     */
 
     /* Instantiates a new yama:None. */
+    /* Failure: */
+    /*   - Memory limit exceeded, or allocator failed. (See ymCtx_SetMemLimit, YmAllocator.) */
     /* Undefined Behaviour: */
     /*   - ctx is invalid. */
     struct YmObj* ymCtx_NewNone(struct YmCtx* ctx);
 
     /* Instantiates a new yama:Int. */
+    /* Failure: */
+    /*   - Memory limit exceeded, or allocator failed. (See ymCtx_SetMemLimit, YmAllocator.) */
     /* Undefined Behaviour: */
     /*   - ctx is invalid. */
     struct YmObj* ymCtx_NewInt(struct YmCtx* ctx, YmInt v);
 
     /* Instantiates a new yama:UInt. */
+    /* Failure: */
+    /*   - Memory limit exceeded, or allocator failed. (See ymCtx_SetMemLimit, YmAllocator.) */
     /* Undefined Behaviour: */
     /*   - ctx is invalid. */
     struct YmObj* ymCtx_NewUInt(struct YmCtx* ctx, YmUInt v);
 
     /* Instantiates a new yama:Float. */
+    /* Failure: */
+    /*   - Memory limit exceeded, or allocator failed. (See ymCtx_SetMemLimit, YmAllocator.) */
     /* Undefined Behaviour: */
     /*   - ctx is invalid. */
     struct YmObj* ymCtx_NewFloat(struct YmCtx* ctx, YmFloat v);
 
     /* Instantiates a new yama:Bool. */
+    /* Failure: */
+    /*   - Memory limit exceeded, or allocator failed. (See ymCtx_SetMemLimit, YmAllocator.) */
     /* Undefined Behaviour: */
     /*   - ctx is invalid. */
     struct YmObj* ymCtx_NewBool(struct YmCtx* ctx, YmBool v);
 
     /* Instantiates a new yama:Rune. */
+    /* Failure: */
+    /*   - Memory limit exceeded, or allocator failed. (See ymCtx_SetMemLimit, YmAllocator.) */
     /* Undefined Behaviour: */
     /*   - ctx is invalid. */
     struct YmObj* ymCtx_NewRune(struct YmCtx* ctx, YmRune v);
 
     /* Instantiates a new yama:Type. */
+    /* Failure: */
+    /*   - Memory limit exceeded, or allocator failed. (See ymCtx_SetMemLimit, YmAllocator.) */
     /* Undefined Behaviour: */
     /*   - ctx is invalid. */
     /*   - v is invalid. */
@@ -1126,11 +1442,170 @@ extern "C" {
     /*   - No return value object bound (by call behaviour.) */
     /*   - Return value object is the wrong type. */
     /*   - Call stack overflow. */
+    /*   - Call is interrupted. (See ymCtx_RequestInterrupt.) */
+    /*   - Call exceeds memory limit. (See ymCtx_SetMemLimit.) */
+    /*   - Call is suspended. (Quiet) (See ymCtx_Suspend.) */
+    /*   - Call stack is suspending. */
     /* Undefined Behaviour: */
     /*   - ctx is invalid. */
     /*   - argNames (pointer) is invalid. */
     YmBool ymCtx_Call(struct YmCtx* ctx, struct YmType* fn, YmUInt16 argsN, const YmChar* argNames, YmLocal returnTo);
 
+    /* NOTE: Calls can be interrupted, either upon request (possibly from another thread), or upon
+    *        exceeding a time limit, so runaway calls can be stopped w/out killing their thread.
+    *
+    *        Interrupts are checked for at the start and end of each call, w/ every call in progress
+    *        then failing, unwinding the call stack, until the user call frame is reached, at which
+    *        point the interrupt is cleared. Call behaviours are expected to return promptly upon
+    *        calls they make failing.
+    *
+    *        Call behaviours which run for a long time w/out making calls should poll for interrupts
+    *        via ymCtx_Interrupted.
+    */
+
+    /* Requests that the call in progress in ctx be interrupted. */
+    /* If no call is in progress, the next call made is interrupted. */
+    /* This function is thread-safe. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    void ymCtx_RequestInterrupt(struct YmCtx* ctx);
+
+    /* Sets the time limit of calls made from the user call frame, such that they're interrupted */
+    /* if not completed within ms milliseconds of being made (or resumed, see ymCtx_Resume.) */
+    /* ms == 0 specifies no time limit, which is the default. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    void ymCtx_SetCallTimeLimit(struct YmCtx* ctx, YmUInt64 ms);
+
+    /* Returns if the call in progress in ctx has been interrupted. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    YmBool ymCtx_Interrupted(struct YmCtx* ctx);
+
+    /* NOTE: Contexts account for the memory of the objects they allocate (see YmMemStat), both in total
+    *        and broken down by object type, so the end-user can tell which calls are bloating memory.
+    *
+    *        Contexts can also be given a memory limit, w/ calls attempting to allocate objects beyond it
+    *        having the allocation fail (w/ YmErrCode_MemLimitExceeded), and then being interrupted (see
+    *        ymCtx_RequestInterrupt), failing w/ YmErrCode_MemLimitExceeded rather than the process running
+    *        out of memory. Objects allocated in the user call frame are accounted for, but their
+    *        allocation doesn't itself fail due to the limit.
+    *
+    *        Stats of objects of a particular type are computed upon query (by walking the objects of
+    *        ctx), rather than tracked upon each allocation, so only YmMemStat_Bytes and YmMemStat_Objects
+    *        are gathered for them.
+    *
+    *        Stats are reset to 0 upon ctx being reset.
+    */
+
+    /* Writes the memory usage stats of objects of type in ctx to stats, indexed by YmMemStat. */
+    /* type == YM_NIL specifies the stats of all objects in ctx. */
+    /* For type != YM_NIL, stats other than YmMemStat_Bytes and YmMemStat_Objects are 0. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    /*   - type is invalid (but not YM_NIL.) */
+    /*   - stats is not a valid array of YmMemStat_Num elements. */
+    void ymCtx_MemUsage(struct YmCtx* ctx, struct YmType* type, YmUInt64* stats);
+
+    /* Sets the memory limit of ctx, such that allocations by calls which would exceed bytes bytes */
+    /* in total (ie. YmMemStat_Bytes) fail, interrupting the call. */
+    /* bytes == 0 specifies no memory limit, which is the default. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    void ymCtx_SetMemLimit(struct YmCtx* ctx, YmUInt64 bytes);
+
+    /* Returns a JSON snapshot of the objects of ctx, for diagnosing what is using its memory. */
+    /* The snapshot is an object w/ the following fields: */
+    /*   - "objects" and "bytes": the number of objects, and their total size. */
+    /*   - "types": an array w/ an entry (w/ fields "type", "objects", "bytes", and "refCounts", */
+    /*     a histogram mapping ref counts to the number of objects w/ them) per object type, */
+    /*     ordered by "bytes", descending. */
+    /* If graph is YM_TRUE, the snapshot also includes the object graph, w/ the fields: */
+    /*   - "nodes": an array w/ an entry (w/ fields "id", "type", and "refs") per object. */
+    /*   - "edges": an array w/ an entry (w/ fields "from", "to", and "slot") per reference one */
+    /*     object holds to another (ie. via stored properties, or protocol boxing.) */
+    /*   - "roots": an array w/ an entry (w/ fields "to" and "kind", and either "index", "var", or */
+    /*     "frame") per reference held by a local object stack, var, or bound return value. */
+    /* "to" is null if the reference is null, or is to an object not in ctx. */
+    /* Objects may be referenced by things other than the above (eg. the end-user.) */
+    /* The returned string memory must be cleaned up by the end-user via free. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    const YmChar* ymCtx_HeapSnapshot(struct YmCtx* ctx, YmBool graph);
+
+    /* NOTE: Calls can be suspended (eg. to wait on I/O completion) and later resumed, w/out blocking
+    *        the thread, so one thread can multiplex many calls in progress.
+    *
+    *        Upon a call behaviour suspending its call, it's expected to return promptly, w/ the call
+    *        stack then unwinding, as w/ interrupts, except that each call frame (w/ its args and
+    *        locals) unwound is detached into the suspension, until the user call frame is reached,
+    *        at which point the call made from it fails (quietly), and ymCtx_Suspended returns true.
+    *
+    *        Call behaviours can't themselves be suspended mid-execution, so upon resuming, the call
+    *        behaviour of the innermost call is called again (w/ its args and locals as they were),
+    *        and upon it completing, that of the call which made it, and so on, w/ ymCtx_Resumed
+    *        telling call behaviours if they're being called again. Call behaviours making calls
+    *        which might suspend are expected to keep track of their progress (eg. in their locals),
+    *        so they can pick up where they left off.
+    *
+    *        If a resumed call fails, the calls which were waiting on it fail too.
+    */
+
+    /* Suspends the call in progress in ctx, returning a new suspension (w/ a taken ref) to */
+    /* later resume it w/, or YM_NIL on failure. */
+    /* If the call stack is already suspending, the same suspension is returned. */
+    /* Calls cannot be made while the call stack is suspending. */
+    /* Failure: */
+    /*   - In user call frame. (Quiet) */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    struct YmSuspension* ymCtx_Suspend(struct YmCtx* ctx);
+
+    /* StkFx: -- result->returnTo */
+    /* Resumes the call suspended into suspension, loading its result into returnTo, returning */
+    /* if successful. */
+    /* Failure: */
+    /*   - Not in user call frame. */
+    /*   - suspension is not resumable (ie. its call stack is still unwinding, it has already */
+    /*     been resumed, or ctx has been reset since.) */
+    /*   - returnTo is out-of-bounds. */
+    /*   - The resumed call fails (or suspends again.) */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    /*   - suspension is invalid. */
+    /*   - suspension was not suspended in ctx. */
+    YmBool ymCtx_Resume(struct YmCtx* ctx, struct YmSuspension* suspension, YmLocal returnTo);
+
+    /* Returns if the call in progress in ctx has been resumed (after suspending.) */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    YmBool ymCtx_Resumed(struct YmCtx* ctx);
+
+    /* Returns if the most recent call made from the user call frame of ctx (including via */
+    /* ymCtx_Resume) suspended, rather than completing or failing. */
+    /* Undefined Behaviour: */
+    /*   - ctx is invalid. */
+    YmBool ymCtx_Suspended(struct YmCtx* ctx);
+
+    /* Increments the ref count of suspension. */
+    /* Returns old ref count value of suspension, or 0. */
+    /* Failure: */
+    /*   - suspension == YM_NIL. (Quiet) (UNTESTED) */
+    YmRefCount ymSuspension_Secure(struct YmSuspension* suspension);
+
+    /* Decrements the ref count of suspension, destroying suspension if it reaches 0. */
+    /* Destroying a suspension which wasn't resumed discards its call. */
+    /* Suspensions hold a ref to their context for as long as they exist. */
+    /* Returns old ref count value of suspension, or 0. */
+    /* Failure: */
+    /*   - suspension == YM_NIL. (Quiet) (UNTESTED) */
+    YmRefCount ymSuspension_Release(struct YmSuspension* suspension);
+
+    /* Returns the ref count of suspension, or 0. */
+    /* Failure: */
+    /*   - suspension == YM_NIL. (Quiet) (UNTESTED) */
+    YmRefCount ymSuspension_RefCount(struct YmSuspension* suspension);
+
     /* Binds what as the return value of the current call, overwriting existing bindings. */
     /* whatPolicy dictates if what ref is borrowed or taken from end-user. */
     /* Failure: */
@@ -1218,6 +1693,139 @@ extern "C" {
     /*   - type is invalid. */
     YmBool ymCtx_Convert(struct YmCtx* ctx, struct YmType* type, YmLocal returnTo);
 
+    /* NOTE: Contexts of a domain share its type information, so objects can be marshalled between
+    *        them w/out any types needing to be resolved.
+    *
+    *        Objects can also be marshalled between contexts of different domains, but only if all
+    *        types in the object graph are ones dst's domain has too (ie. builtins, as each domain
+    *        loads types of its own.)
+    *
+    *        Marshalling copies the whole object graph reachable from the object (ie. stored property
+    *        values, and values boxed by protocol values), w/ objects referenced multiple times in
+    *        the graph being copied only once, so sharing (and cycles) are preserved in the copy.
+    */
+
+    /* StkFx: -- copy */
+    /* Pushes onto dst a deep copy of the object at local in src, returning if successful. */
+    /* src is not modified, and dst == src is allowed. */
+    /* Failure: */
+    /*   - local is out-of-bounds in src. */
+    /*   - The type of an object (or type object) being copied is not found in dst's domain. */
+    /* Undefined Behaviour: */
+    /*   - dst is invalid. */
+    /*   - src is invalid. */
+    /*   - src is used by another thread during marshalling. */
+    YmBool ymCtx_Marshal(struct YmCtx* dst, struct YmCtx* src, YmLocal local);
+
+
+    /* Executor API */
+
+    /* NOTE: Executors spread calls across cores, w/ each worker thread performing calls in a context
+    *        of its own (associated w/ the executor's domain.)
+    *
+    *        Jobs are queued on the workers round-robin (or on the submitting worker, if submitted by
+    *        a call behaviour or callback running on one), w/ idle workers stealing jobs from the
+    *        queues of busy ones.
+    *
+    *        Contexts are reset between jobs, so objects and var values don't carry over from one
+    *        job to the next, but loaded types do.
+    *
+    *        Args and results are passed as primitive values (see YmPrimitive), so that they needn't
+    *        be bound to any particular context.
+    */
+
+    typedef enum : YmUInt8 {
+        YmPrimitiveKind_None = 0,
+        YmPrimitiveKind_Int,
+        YmPrimitiveKind_UInt,
+        YmPrimitiveKind_Float,
+        YmPrimitiveKind_Bool,
+        YmPrimitiveKind_Rune,
+        YmPrimitiveKind_Type,
+
+        YmPrimitiveKind_Num, /* Enum size. Not a valid primitive kind. */
+    } YmPrimitiveKind;
+
+    /* A yama:None, yama:Int, yama:UInt, yama:Float, yama:Bool, yama:Rune, or yama:Type value. */
+    /* kind dictates which field of the union is used (w/ none used if YmPrimitiveKind_None.) */
+    typedef struct {
+        YmPrimitiveKind kind;
+        union {
+            YmInt i;
+            YmUInt ui;
+            YmFloat f;
+            YmBool b;
+            YmRune r;
+            struct YmType* type;
+        };
+    } YmPrimitive;
+
+    /* Called on a worker thread once a job has been performed. */
+    /* succeeded is if the call succeeded. */
+    /* result is the return value of the call, or YM_NIL if the call failed, or returned a non-primitive. */
+    /* result is only valid for the duration of the callback. */
+    /* Callbacks may submit further jobs, but must not wait on (see ymExecutor_Wait), nor destroy (see ymExecutor_Release), their executor, as either would deadlock. */
+    typedef void(*YmExecutorCallbackFn)(void* user, YmBool succeeded, const YmPrimitive* result);
+
+    /* Creates a new Yama executor, w/ workers worker threads, returning a pointer to it. */
+    /* workers == 0 specifies a worker per hardware thread. */
+    /* The executor holds a ref to dm for as long as it exists. */
+    /* Undefined Behaviour: */
+    /*   - dm is invalid. */
+    struct YmExecutor* ymExecutor_Create(struct YmDm* dm, size_t workers);
+
+    /* Increments the ref count of executor. */
+    /* Returns old ref count value of executor, or 0. */
+    /* Failure: */
+    /*   - executor == YM_NIL. (Quiet) (UNTESTED) */
+    YmRefCount ymExecutor_Secure(struct YmExecutor* executor);
+
+    /* Decrements the ref count of executor, destroying executor if it reaches 0. */
+    /* Destroying an executor waits for its jobs to be performed (see ymExecutor_Wait.) */
+    /* Returns old ref count value of executor, or 0. */
+    /* Failure: */
+    /*   - executor == YM_NIL. (Quiet) (UNTESTED) */
+    /* Undefined Behaviour: */
+    /*   - executor is destroyed on one of its own worker threads. */
+    YmRefCount ymExecutor_Release(struct YmExecutor* executor);
+
+    /* Returns the ref count of executor, or 0. */
+    /* Failure: */
+    /*   - executor == YM_NIL. (Quiet) (UNTESTED) */
+    YmRefCount ymExecutor_RefCount(struct YmExecutor* executor);
+
+    /* Returns the number of worker threads of executor. */
+    /* Undefined Behaviour: */
+    /*   - executor is invalid. */
+    size_t ymExecutor_Workers(struct YmExecutor* executor);
+
+    /* Submits a job to executor, which loads fn, and calls it w/ args, returning if successful. */
+    /* argsN and argNames are as in ymCtx_Call. */
+    /* callback (if any) is called w/ user once the job has been performed. */
+    /* Errors arising from the job are raised on the worker thread, via the err callback of the submitting thread. */
+    /* Failure: */
+    /*   - fn is not a legal fullname. */
+    /* Undefined Behaviour: */
+    /*   - executor is invalid. */
+    /*   - fn (pointer) is invalid. */
+    /*   - args is not a valid array of argsN elements. */
+    /*   - argNames (pointer) is invalid. */
+    /*   - callback is invalid. */
+    YmBool ymExecutor_Submit(
+        struct YmExecutor* executor,
+        YmFullname fn,
+        const YmPrimitive* args,
+        YmUInt16 argsN,
+        const YmChar* argNames,
+        YmExecutorCallbackFn callback,
+        void* user);
+
+    /* Blocks until all jobs submitted to executor have been performed (and their callbacks have returned.) */
+    /* Undefined Behaviour: */
+    /*   - executor is invalid. */
+    /*   - Called on one of executor's own worker threads. */
+    void ymExecutor_Wait(struct YmExecutor* executor);
+
 
     /* Parcel Def. API */
 
@@ -1594,6 +2202,99 @@ extern "C" {
         const YmChar* typeName,
         YmRefSym symbol);
 
+    /* YmTypeDescKind specifies what a YmTypeDesc describes, w/ each corresponding to a ymParcelDef_Add* fn. */
+    typedef enum : YmUInt8 {
+        YmTypeDescKind_Struct = 0,                  /* See ymParcelDef_AddStruct. */
+        YmTypeDescKind_Protocol,                    /* See ymParcelDef_AddProtocol. */
+        YmTypeDescKind_Fn,                          /* See ymParcelDef_AddFn. */
+        YmTypeDescKind_ReadOnlyStoredVar,           /* See ymParcelDef_AddReadOnlyStoredVar. */
+        YmTypeDescKind_StoredVar,                   /* See ymParcelDef_AddStoredVar. */
+        YmTypeDescKind_ReadOnlyComputedVar,         /* See ymParcelDef_AddReadOnlyComputedVar. */
+        YmTypeDescKind_ComputedVar,                 /* See ymParcelDef_AddComputedVar. */
+        YmTypeDescKind_Method,                      /* See ymParcelDef_AddMethod. */
+        YmTypeDescKind_MethodReq,                   /* See ymParcelDef_AddMethodReq. */
+        YmTypeDescKind_ReadOnlyStoredProperty,      /* See ymParcelDef_AddReadOnlyStoredProperty. */
+        YmTypeDescKind_StoredProperty,              /* See ymParcelDef_AddStoredProperty. */
+        YmTypeDescKind_ReadOnlyComputedProperty,    /* See ymParcelDef_AddReadOnlyComputedProperty. */
+        YmTypeDescKind_ComputedProperty,            /* See ymParcelDef_AddComputedProperty. */
+
+        YmTypeDescKind_Num,                         /* Enum size. Not a valid type desc. kind. */
+    } YmTypeDescKind;
+
+    /* Describes a parameter or type parameter, for use w/ YmTypeDesc. */
+    typedef struct {
+        const YmChar* name;
+        YmRefSym type;                              /* Parameter type, or type parameter constraint type. */
+    } YmParamDesc;
+
+    /* Describes a type to add to a parcel def via ymParcelDef_AddBulk. */
+    /* Fields which don't apply to the kind of type described are ignored. */
+    typedef struct {
+        YmTypeDescKind kind;
+        const YmChar* ownerName;                    /* Owner name of methods, method reqs., and properties. */
+        const YmChar* name;
+        YmRefSym type;                              /* Return type of fns/methods/method reqs., or type of vars/properties. */
+        YmCallBhvrCallbackFn behaviour;             /* Call behaviour of fns/methods, init behaviour of stored vars, or get behaviour of computed vars/properties. */
+        void* behaviourData;
+        YmCallBhvrCallbackFn setBehaviour;          /* Set behaviour of computed vars/properties. */
+        void* setBehaviourData;
+        const YmParamDesc* typeParams;              /* Type parameters of structs/protocols. May be YM_NIL if typeParamsN == 0. */
+        size_t typeParamsN;
+        const YmParamDesc* params;                  /* Positional parameters of fns/methods/method reqs. May be YM_NIL if paramsN == 0. */
+        size_t paramsN;
+        const YmParamDesc* namedParams;             /* Named parameters of fns/methods. May be YM_NIL if namedParamsN == 0. */
+        size_t namedParamsN;
+        const YmRefSym* refs;                       /* Reference symbols. May be YM_NIL if refsN == 0. */
+        size_t refsN;
+    } YmTypeDesc;
+
+    /* Adds the types described by descs to parceldef, along w/ their type parameters, parameters, and references, */
+    /* returning the number of descs added. */
+    /* n is the number of descs. */
+    /* Descs are added in order, as if via the ymParcelDef_Add* fns corresponding to them, stopping at the first which fails, */
+    /* the type of which may have been partially added (ie. as if defined via ymParcelDef_Add* calls up until the failing one.) */
+    /* Failure: */
+    /*   - Any desc fails, for any reason the ymParcelDef_Add* fns corresponding to it could fail. */
+    /*   - Any desc w/ named parameters describes a type which cannot have them. */
+    /* Undefined Behaviour: */
+    /*   - parceldef is invalid. */
+    /*   - descs is not a valid array of n descs. */
+    /*   - The kind of any desc is invalid. */
+    /*   - Any non-ignored field of any desc is invalid. */
+    size_t ymParcelDef_AddBulk(struct YmParcelDef* parceldef, const YmTypeDesc* descs, size_t n);
+
+    /* NOTE: Parcel defs can be serialized to a compact, versioned, binary form, which is far cheaper to
+    *        deserialize (eg. in a later process, from a memory-mapped file) than it is to build the parcel
+    *        def again, as symbols are serialized already normalized. Specifiers and names are nevertheless
+    *        checked upon deserialization, so corrupted data fails to deserialize, rather than yielding an
+    *        illegal parcel def. Deserialized parcel defs are verified upon being bound, like any other.
+    * 
+    *        Non-builtin call behaviours (ie. those provided by the end-user) can't be serialized, and so are
+    *        instead relinked, by the local name of their type, upon deserialization.
+    */
+
+    /* Serializes parceldef to buffer, returning the size (in bytes) of the serialized parcel def, or 0 on failure. */
+    /* Nothing is written if bufferSize is less than the size returned, letting the end-user query the size needed. */
+    /* Failure: */
+    /*   - parceldef fails verification. */
+    /* Undefined Behaviour: */
+    /*   - parceldef is invalid. */
+    /*   - buffer is not a valid array of bufferSize bytes. */
+    size_t ymParcelDef_Serialize(struct YmParcelDef* parceldef, void* buffer, size_t bufferSize);
+
+    /* Deserializes the parcel def serialized in data, returning a new parcel def, or YM_NIL on failure. */
+    /* size is the size (in bytes) of data, which needn't outlive the call. */
+    /* relink is used to relink non-builtin call behaviours, and may be YM_NIL if there are none to relink. */
+    /* Failure: */
+    /*   - data is not a serialized parcel def, or is of an incompatible version. */
+    /*   - data is malformed (eg. truncated, or w/ an illegal specifier or name.) */
+    /*   - Any call behaviour could not be relinked. */
+    /* Undefined Behaviour: */
+    /*   - data is not a valid array of size bytes. */
+    /*   - relink is invalid. */
+    /*   - data was not serialized by ymParcelDef_Serialize, or was modified since (other than in ways detected as it being malformed.) */
+    struct YmParcelDef* ymParcelDef_Deserialize(const void* data, size_t size, YmRelinkCallBhvrCallbackFn relink, void* user);
+
 
     /* Parcel API */
 
@@ -1643,11 +2344,19 @@ extern "C" {
     YmMembers ymType_Members(struct YmType* type);
 
     /* Returns the member at member in type, or YM_NIL on failure. */
+    /* Member types are loaded upon first access. */
+    /* Failure: */
+    /*   - member is out of bounds. (Quiet) */
+    /*   - The member type fails to load. */
     /* Undefined Behaviour: */
     /*   - type is invalid. */
     YmType* ymType_MemberByIndex(struct YmType* type, YmMemberIndex member);
 
     /* Returns the member under name in type, or YM_NIL on failure. */
+    /* Member types are loaded upon first access. */
+    /* Failure: */
+    /*   - No member exists under name. (Quiet) */
+    /*   - The member type fails to load. */
     /* Undefined Behaviour: */
     /*   - type is invalid. */
     /*   - name (pointer) is invalid. */
@@ -57,6 +57,7 @@ include "sandbox"
 include "Yama"
 include "Yama.Tests"
 include "Yama.Sandbox"
+include "Yama.Benchmarks"
 --include "Yama.Examples"
 
 include "vendor/TAUL/taul" -- include just taul.lib part
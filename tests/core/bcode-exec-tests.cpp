@@ -1,5 +1,8 @@
 
 
+#include <chrono>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include <yama/core/bcode.h>
@@ -1681,6 +1684,45 @@ TEST_F(BCodeExecTests, JumpFalse) {
     EXPECT_EQ(ctx->local(1).value(), ctx->new_int(4));
 }
 
+// INTERRUPT TESTS
+
+TEST_F(BCodeExecTests, PanicIfInterruptRequested) {
+    ASSERT_TRUE(ready);
+
+    const auto f_bcode =
+        yama::bc::code()
+        // block #1
+        .add_put_const(yama::newtop, 1)
+        // block #2 (loops forever)
+        .add_noop()
+        .add_jump(-2);
+    std::cerr << f_bcode.fmt_disassembly() << "\n";
+    const auto f_consts =
+        yama::const_table()
+        .add_primitive_type("yama:Int"_str)
+        .add_int(101);
+    our_parcel->mh.add_function(
+        "f"_str,
+        f_consts,
+        yama::make_callsig({}, 0),
+        1,
+        f_bcode);
+
+    const auto f = ctx->load("abc:f"_str).value();
+
+    std::jthread other([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ctx->request_interrupt();
+        });
+
+    ASSERT_TRUE(ctx->push_fn(f).good());
+    ASSERT_TRUE(ctx->call(1, yama::newtop).bad()); // panic! interrupted
+
+    EXPECT_EQ(ctx->panics(), 1);
+    EXPECT_TRUE(ctx->is_user());
+    EXPECT_EQ(ctx->call_frames(), 1);
+}
+
 // EXAMPLE TESTS
 
 static yama::uint_t example_fac(yama::uint_t n) noexcept {
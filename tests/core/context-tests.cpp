@@ -3027,6 +3027,37 @@ TEST_F(ContextTests, Call_BCodeExec) {
     EXPECT_TRUE(globals.even_reached); // acknowledge f call behaviour occurred
 }
 
+TEST_F(ContextTests, Call_PanicIfInterruptRequested) {
+    ASSERT_TRUE(ready);
+
+    upload_f();
+    ASSERT_TRUE(dm->load("abc:f"_str));
+    const yama::item_ref f = dm->load("abc:f"_str).value();
+
+    EXPECT_EQ(ctx->panics(), 0);
+
+    ctx->request_interrupt(); // no call in progress, so next call panics
+
+    ASSERT_TRUE(ctx->push_fn(f).good());
+    ASSERT_TRUE(ctx->push_int(-4).good());
+    ASSERT_TRUE(ctx->call(2, yama::newtop).bad()); // panic! interrupted
+
+    EXPECT_EQ(ctx->panics(), 1);
+
+    EXPECT_FALSE(globals.even_reached);
+
+    // interrupt was cleared by the panic it induced
+
+    ASSERT_TRUE(ctx->push_fn(f).good());
+    ASSERT_TRUE(ctx->push_int(-4).good());
+    globals.int_arg_value_called_with = -4;
+    globals.expected_call_frames = 2;
+    ASSERT_TRUE(ctx->call(2, yama::newtop).good());
+
+    EXPECT_EQ(ctx->panics(), 1);
+    EXPECT_TRUE(globals.even_reached);
+}
+
 TEST_F(ContextTests, Call_PanicIfArgsProvidesNoCallObj) {
     ASSERT_TRUE(ready);
 
@@ -261,6 +261,10 @@ void yama::context::panic() {
     _try_handle_panic_for_user_cf(); // in case panicking outside of a call
 }
 
+void yama::context::request_interrupt() noexcept {
+    _interrupt_requested.store(true, std::memory_order_relaxed);
+}
+
 yama::cmd_status yama::context::pop(size_t n) {
     _pop_regs(n);
     return cmd_status::init(true);
@@ -1006,6 +1010,9 @@ std::optional<yama::object_ref> yama::context::_call(size_t args_n) {
     if (_call_err_param_arg_count_mismatch(callobj, param_args)) {
         return std::nullopt;
     }
+    if (_call_err_interrupted(callobj)) {
+        return std::nullopt;
+    }
     const auto callobj_mem = internal::get_item_mem(callobj_type);
     // push our new call frame
     const bool push_cf_result = _push_cf(std::make_optional(callobj_type), args_start, args_n, callobj_mem->max_locals);
@@ -1095,6 +1102,16 @@ bool yama::context::_call_err_param_arg_count_mismatch(borrowed_ref callobj, siz
     return true;
 }
 
+bool yama::context::_call_err_interrupted(borrowed_ref callobj) {
+    // cheap relaxed load first, so we don't pay for an atomic RMW every call
+    if (!_interrupt_requested.load(std::memory_order_relaxed)) return false;
+    _interrupt_requested.store(false, std::memory_order_relaxed);
+    _panic(
+        "error: panic from call to {} due to interrupt request!",
+        callobj);
+    return true;
+}
+
 bool yama::context::_call_err_push_cf_would_overflow(borrowed_ref callobj, bool push_cf_result) {
     if (push_cf_result) return false;
     _panic(
@@ -1166,6 +1183,7 @@ void yama::context::_bcode_exec() {
     while (!_top_cf().should_halt) {
         const auto x = _bcode_fetch_instr();
         _bcode_exec_instr(x);
+        _bcode_panic_if_interrupted();
         _bcode_halt_if_panicking();
     }
 }
@@ -1284,6 +1302,13 @@ void yama::context::_bcode_exec_instr(bc::instr x) {
     }
 }
 
+void yama::context::_bcode_panic_if_interrupted() {
+    // this is checked every instr (so loops can be interrupted), so keep it to a relaxed load
+    if (!_interrupt_requested.load(std::memory_order_relaxed)) return;
+    _interrupt_requested.store(false, std::memory_order_relaxed);
+    _panic("error: panic from interrupt request!");
+}
+
 void yama::context::_bcode_halt_if_panicking() {
     if (panicking()) {
         _bcode_halt();
@@ -3,6 +3,8 @@
 #pragma once
 
 
+#include <atomic>
+
 #include "scalars.h"
 #include "res.h"
 #include "api_component.h"
@@ -284,6 +286,11 @@ namespace yama {
 
         // Induces a panic.
         void panic();
+        // Requests that the context panic, aborting the call in progress, upon its next call,
+        // or its next bcode instr, allowing runaway calls to be stopped.
+        // If no call is in progress, the next call made panics.
+        // request_interrupt is thread-safe.
+        void request_interrupt() noexcept;
 
         // pop pops the top n local object stack objects.
         // 
@@ -518,6 +525,7 @@ namespace yama {
         //      - If args_n-1 is not equal to the argument count expected for a call to callobj (here, the -1
         //        excludes callobj from argument count.)
         //      - If the call stack would overflow.
+        //      - If an interrupt has been requested (see request_interrupt.)
         //      - If, after call behaviour has completed execution, no return value object has been provided.
         cmd_status call(size_t args_n, local_t ret);
 
@@ -535,6 +543,7 @@ namespace yama {
         //      - If args_n-1 is not equal to the argument count expected for a call to callobj (here, the -1
         //        excludes callobj from argument count.)
         //      - If the call stack would overflow.
+        //      - If an interrupt has been requested (see request_interrupt.)
         //      - If, after call behaviour has completed execution, no return value object has been provided.
         cmd_status call_nr(size_t args_n);
 
@@ -557,6 +566,7 @@ namespace yama {
 
         size_t _panics = 0;
         bool _panicking = false;
+        std::atomic_bool _interrupt_requested = false; // cleared upon the panic it induces
 
         // NOTE: _cf_t must use indices, as reallocs in _registers will invalidate pointers
 
@@ -714,6 +724,7 @@ namespace yama {
         bool _call_err_args_out_of_bounds(size_t args_n);
         bool _call_err_callobj_not_callable_type(borrowed_ref callobj);
         bool _call_err_param_arg_count_mismatch(borrowed_ref callobj, size_t param_args);
+        bool _call_err_interrupted(borrowed_ref callobj);
         bool _call_err_push_cf_would_overflow(borrowed_ref callobj, bool push_cf_result);
         bool _call_err_no_return_value_object(borrowed_ref callobj);
 
@@ -734,6 +745,7 @@ namespace yama {
         const bc::code* _bcode_acquire_bcode();
         bc::instr _bcode_fetch_instr();
         void _bcode_exec_instr(bc::instr x);
+        void _bcode_panic_if_interrupted();
         void _bcode_halt_if_panicking();
         void _bcode_halt();
         void _bcode_jump(int16_t offset);